@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+// pkedit-bench: end-to-end timings of the editor's hot paths over a corpus of
+// save files. Runs headless (QT_QPA_PLATFORM=offscreen) and writes JSON with
+// medians and percentiles so that upgrades can be gated on the numbers.
+
+#include "init.h"
+#include "save.h"
+#include "trainer.h"
+#include "ui_mainwindow.h"
+#include "window.h"
+
+#include <QApplication>
+#include <QTimer>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+struct bench_result {
+    std::string name;
+    std::string file;
+    std::vector<double> samples_us;
+};
+
+// Grants the benchmarks access to MainWindow's private editor entry points.
+class window_bench {
+  public:
+    // Replaces the shown save rather than opening another tab per iteration.
+    // The benchmarked edits are never saved, so close_save must not stop to
+    // ask about them on a dialog nobody can see.
+    static void load(MainWindow &w, const pkmn_save &save)
+    {
+        if (w.save_loaded) {
+            w.edits->flush();
+            w.save_modified = false;
+            w.close_save(w.shown_save);
+        }
+        w.set_loaded_save(save, QString::fromStdString(save.file_name));
+    }
+    static pkmn_save &save(MainWindow &w) { return w.save; }
+    static void edit(MainWindow &w, pokemon *pkmn)
+    {
+        w.sel_pkmn_table_view = w.ui->partyTableView;
+        w.set_pkmn_in_editor(pkmn);
+    }
+    static void update_party(MainWindow &w) { w.update_party_table_row(); }
+    static void populate_items(MainWindow &w)
+    {
+        for (item_table_model *model : w.item_models) {
+            model->set_save(&w.save);
+            for (int row = 0; row < model->rowCount(); ++row) {
+                model->data(model->index(row, ITEM_TABLE_NAME_COL));
+                model->data(model->index(row, ITEM_TABLE_QUANTITY_COL));
+            }
+        }
+    }
+    // Commits debounced edits and the resulting stat refresh without waiting
+    // for the debounce window or the next frame.
+    static void flush_edits(MainWindow &w)
+    {
+        w.edits->flush();
+        if (w.stats_refresh_timer->isActive()) {
+            w.stats_refresh_timer->stop();
+            w.update_stats_on_ui(w.sel_pkmn);
+        }
+    }
+    static QSpinBox *hp_iv_spin_box(MainWindow &w) { return w.ui->hpIvSpinBox; }
+    static QSpinBox *hp_ev_spin_box(MainWindow &w) { return w.ui->hpevSpinBox; }
+    static const name_search_index *move_search(MainWindow &w, const pokemon *pkmn)
+    {
+        return w.combo_models.search_index(w.combo_models.moves(pkmn));
+    }
+};
+
+static double time_us(const std::function<void()> &fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+static double percentile(std::vector<double> sorted, double p)
+{
+    if (sorted.empty())
+        return 0;
+    const double rank = p / 100.0 * (sorted.size() - 1);
+    const usize lo = static_cast<usize>(rank);
+    const usize hi = std::min(lo + 1, sorted.size() - 1);
+    return sorted[lo] + (sorted[hi] - sorted[lo]) * (rank - lo);
+}
+
+static std::string json_escape(const std::string &s)
+{
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+static void write_results(FILE *fp, const std::vector<bench_result> &results, int iterations)
+{
+    fprintf(fp, "{\n  \"iterations\": %d,\n  \"benchmarks\": [", iterations);
+    for (usize i = 0; i < results.size(); ++i) {
+        std::vector<double> sorted { results[i].samples_us };
+        std::sort(sorted.begin(), sorted.end());
+        fprintf(fp,
+                "%s\n    {\"name\": \"%s\", \"file\": \"%s\", \"samples\": %zu, "
+                "\"min_us\": %.3f, \"median_us\": %.3f, \"p90_us\": %.3f, \"p99_us\": %.3f, "
+                "\"max_us\": %.3f}",
+                i == 0 ? "" : ",", json_escape(results[i].name).c_str(),
+                json_escape(results[i].file).c_str(), sorted.size(),
+                sorted.empty() ? 0.0 : sorted.front(), percentile(sorted, 50),
+                percentile(sorted, 90), percentile(sorted, 99),
+                sorted.empty() ? 0.0 : sorted.back());
+    }
+    fputs("\n  ]\n}\n", fp);
+}
+
+static std::vector<fs::path> collect_corpus(const std::vector<std::string> &args)
+{
+    std::vector<fs::path> files;
+    for (const auto &arg : args) {
+        if (fs::is_directory(arg)) {
+            for (const auto &entry : fs::recursive_directory_iterator(arg))
+                if (entry.is_regular_file() && entry.path().extension() == ".sav")
+                    files.push_back(entry.path());
+        } else {
+            files.emplace_back(arg);
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+static void bench_file(MainWindow &w, const fs::path &path, int iterations,
+                       std::vector<bench_result> &results)
+{
+    const std::string file { path.string() };
+    auto run = [&](const std::string &name, const std::function<void()> &fn) {
+        bench_result r { name, file, {} };
+        r.samples_us.reserve(iterations);
+        for (int i = 0; i < iterations; ++i)
+            r.samples_us.push_back(time_us(fn));
+        results.push_back(std::move(r));
+    };
+
+    run("open_file_to_populated_ui", [&] {
+        window_bench::load(w, read_pkmn_save_file(file.c_str()));
+        QCoreApplication::processEvents();
+    });
+
+    pkmn_save &save = window_bench::save(w);
+    const auto &team = save.trainer->pkmn_team();
+    if (team.empty())
+        return;
+
+    const std::string gen { "gen" + std::to_string(team[0]->generation()) };
+    run("set_pkmn_in_editor/" + gen, [&] {
+        for (const auto &pkmn : team)
+            window_bench::edit(w, pkmn.get());
+    });
+
+    run("update_party_table_row", [&] { window_bench::update_party(w); });
+    run("item_table_population", [&] { window_bench::populate_items(w); });
+
+    // One query per keystroke of typing a move name, misspelt at the end.
+    const name_search_index *moves = window_bench::move_search(w, team[0].get());
+    const QString typed { "thunderbilt" };
+    run("name_search_keystroke/" + gen, [&] {
+        for (qsizetype len = 1; len <= typed.size(); ++len)
+            moves->search(typed.left(len), combo_name_search::MAX_RESULTS);
+    });
+
+    window_bench::edit(w, team[0].get());
+    QSpinBox *iv = window_bench::hp_iv_spin_box(w);
+    QSpinBox *ev = window_bench::hp_ev_spin_box(w);
+    // setValue() with the shown value emits nothing, so each iteration steps
+    // to a different value within [minimum, cap].
+    auto step = [](QSpinBox *spin_box, int cap) {
+        const int low = spin_box->minimum();
+        const int high = std::min(spin_box->maximum(), cap);
+        spin_box->setValue(spin_box->value() >= high ? low : spin_box->value() + 1);
+    };
+    if (iv->maximum() > iv->minimum())
+        run("iv_edit_to_stat_refresh", [&] {
+            step(iv, iv->maximum());
+            window_bench::flush_edits(w);
+            QCoreApplication::processEvents();
+        });
+    if (ev->maximum() > ev->minimum())
+        run("ev_edit_to_stat_refresh", [&] {
+            step(ev, 252);
+            window_bench::flush_edits(w);
+            QCoreApplication::processEvents();
+        });
+
+    const fs::path out { fs::temp_directory_path() / ("pkedit-bench-" + path.filename().string()) };
+    run("save_round_trip", [&] {
+        save.trainer->save();
+        write_pkmn_save_file(out.string().c_str(), save, false);
+        pkmn_save reread { read_pkmn_save_file(out.string().c_str()) };
+        delete reread.trainer;
+    });
+    fs::remove(out);
+}
+
+int main(int argc, char *argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    int iterations = 20;
+    const char *output = nullptr;
+    std::vector<std::string> inputs;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+            iterations = std::max(1, atoi(argv[++i]));
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            output = argv[++i];
+        else
+            inputs.emplace_back(argv[i]);
+    }
+
+    if (inputs.empty()) {
+        fprintf(stderr, "usage: %s [--iterations N] [--output results.json] <save|dir>...\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    try {
+        init_pkedit();
+    } catch (const std::exception &e) {
+        fprintf(stderr, "Error initializing libpkedit: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+
+    QApplication a(argc, argv);
+    std::promise<void> ready;
+    ready.set_value();
+    MainWindow w { ready.get_future().share() };
+    w.show();
+
+    std::vector<bench_result> results;
+    for (const auto &path : collect_corpus(inputs)) {
+        try {
+            bench_file(w, path, iterations, results);
+        } catch (const std::exception &e) {
+            fprintf(stderr, "pkedit-bench: %s: %s\n", path.string().c_str(), e.what());
+        }
+    }
+
+    FILE *fp = output != nullptr ? fopen(output, "w") : stdout;
+    if (fp == nullptr) {
+        fprintf(stderr, "pkedit-bench: unable to open %s\n", output);
+        return EXIT_FAILURE;
+    }
+    write_results(fp, results, iterations);
+    if (fp != stdout)
+        fclose(fp);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_BATCH_H
+#define QT_BATCH_H
+
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Options for running pkedit-qt without a GUI over a directory of save files.
+struct batch_options {
+    std::string directory {};
+    unsigned jobs { 0 }; // 0 means one worker per hardware thread
+    bool backup_save { true };
+    bool recursive { false };
+    std::optional<unsigned> money {};
+    std::optional<unsigned> coins {};
+};
+
+// Upper bound on worker threads for --jobs; more only adds contention.
+constexpr unsigned MAX_JOBS = 256;
+
+// Parses the value given for the command-line option `flag`. Throws
+// std::runtime_error if it is missing, not an unsigned integer or above `max`.
+unsigned parse_uint_arg(const char *flag, const char *value,
+                        unsigned max = std::numeric_limits<unsigned>::max());
+
+// Returns true if argv requests batch mode, in which case `out` is filled in.
+// Throws std::runtime_error on malformed arguments.
+bool parse_batch_args(int argc, char *argv[], batch_options &out);
+
+// The .sav files in `directory`, sorted by path. Throws std::filesystem_error
+// if the directory can't be read.
+std::vector<std::filesystem::path> collect_save_files(const std::string &directory,
+                                                      bool recursive);
+
+// Loads, edits and writes back every save file in the directory using a pool
+// of worker threads. Returns a process exit code.
+int run_batch(const batch_options &opt);
+
+#endif // QT_BATCH_H
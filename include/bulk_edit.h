@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_BULK_EDIT_H
+#define QT_BULK_EDIT_H
+
+#include "pokemon.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+enum class bulk_edit_op : u8 {
+    Max_Ivs,
+    Reset_Evs,
+    Restore_Pp,
+    Heal_Status,
+    Set_Level,
+    Trade_Evolve,
+};
+
+struct bulk_edit_result {
+    // Pokemon the operation applied to.
+    usize changed { 0 };
+    // Index into the targets and reason for each Pokemon it could not be
+    // applied to.
+    std::vector<std::pair<usize, std::string>> errors {};
+    double ms { 0 };
+};
+
+const char *bulk_edit_name(bulk_edit_op);
+
+// Applies `op` to each of `targets`; `value` is the level for Set_Level. A
+// Pokemon that rejects the edit is reported and the rest are still edited.
+// Nothing is redrawn; the caller refreshes the views once afterwards.
+bulk_edit_result apply_bulk_edit(const std::vector<pokemon *> &targets, bulk_edit_op, int value,
+                                 bool allow_illegal_modifications);
+
+#endif // QT_BULK_EDIT_H
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_COMBO_MODELS_H
+#define QT_COMBO_MODELS_H
+
+#include "name_search.h"
+#include "pokemon.h"
+#include "save.h"
+#include "trainer.h"
+
+#include <QHash>
+#include <QStringListModel>
+
+#include <map>
+#include <memory>
+#include <tuple>
+
+// Name lists from libpkedit's static tables, converted to QString once per
+// generation and shared by every combo box that displays them. Combo boxes
+// using these models must not be cleared or allowed to insert entries.
+//
+// Each list is indexed by name when it is built, so finding a name's row is a
+// hash lookup instead of a scan of the list.
+class combo_model_cache {
+  public:
+    enum class list_kind : u8 {
+        Species,
+        Moves,
+        Items,
+        Locations,
+        Pocket_Items,
+    };
+
+    QStringListModel *species(const pokemon *);
+    QStringListModel *moves(const pokemon *);
+    QStringListModel *items(const pokemon *, const pkmn_save &);
+    QStringListModel *locations(const pokemon *);
+    // Names that can be put in an item pocket of `save`. Each open save keeps
+    // its own lists until clear_save_lists() is called for it.
+    QStringListModel *pocket_items(const pkmn_save &save, item_category);
+
+    // Row of the first entry called `name` in a model returned by this cache,
+    // or -1.
+    int row_of(const QStringListModel *, const QString &name) const;
+    // Type-ahead index over a model returned by this cache, built on first
+    // use and shared by every combo box displaying the model.
+    const name_search_index *search_index(const QStringListModel *);
+    // Row of the met location with libpkedit id `id` in locations(), or -1.
+    int location_row(const pokemon *, u16 id);
+
+    // Drops the lists that depend on `save` rather than on the generation,
+    // before its trainer is freed. Combo boxes showing them fall back to an
+    // empty model.
+    void clear_save_lists(const pkmn_save &save);
+
+  private:
+    struct cached_list {
+        std::unique_ptr<QStringListModel> model {};
+        QHash<QString, int> rows {};
+        std::unique_ptr<name_search_index> search {};
+    };
+
+    // Keyed by kind, generation or item category, and the trainer of the
+    // save for lists that depend on it.
+    std::map<std::tuple<list_kind, u8, const void *>, cached_list> lists;
+    QHash<const QStringListModel *, cached_list *> by_model;
+    std::map<u8, QHash<u16, int>> location_rows;
+
+    template <typename Producer>
+    QStringListModel *get(list_kind, u8 key, Producer &&, const void *owner = nullptr);
+};
+
+#endif // QT_COMBO_MODELS_H
@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_DIFF_DIALOG_H
+#define QT_DIFF_DIALOG_H
+
+#include "save_diff.h"
+
+#include <QDialog>
+
+enum {
+    DIFF_TABLE_WHERE_COL = 0,
+    DIFF_TABLE_FIELD_COL = 1,
+    DIFF_TABLE_BEFORE_COL = 2,
+    DIFF_TABLE_AFTER_COL = 3,
+    DIFF_TABLE_COLUMN_COUNT = 4,
+};
+
+// Shows the field-level report of a save_diff between `base` and `other`.
+class diff_dialog : public QDialog {
+    Q_OBJECT
+
+  public:
+    diff_dialog(const QString &base, const QString &other, const save_diff &,
+                QWidget *parent = nullptr);
+};
+
+#endif // QT_DIFF_DIALOG_H
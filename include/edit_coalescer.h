@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_EDIT_COALESCER_H
+#define QT_EDIT_COALESCER_H
+
+#include <QHash>
+#include <QObject>
+
+#include <functional>
+
+class QTimer;
+
+// Coalesces rapid edits of the same field into a single commit. Each call to
+// schedule() for a field replaces that field's pending commit and restarts its
+// debounce timer, so holding down a spin box arrow or typing a name results in
+// one call into libpkedit once the field settles.
+//
+// Commits should read the widget's current value when they run rather than
+// capturing it, and pending commits must be flushed before the object they
+// target changes (e.g. selecting another Pokemon or saving).
+class edit_coalescer : public QObject {
+    Q_OBJECT
+    struct pending_edit {
+        QTimer *timer { nullptr };
+        std::function<void()> commit {};
+    };
+    QHash<const QObject *, pending_edit> pending;
+
+    void run(const QObject *, pending_edit &);
+
+  public:
+    explicit edit_coalescer(QObject *parent = nullptr);
+
+    void schedule(const QObject *field, int delay_ms, std::function<void()> commit);
+    // Runs every pending commit immediately.
+    void flush();
+    // Drops every pending commit without running it.
+    void cancel() noexcept;
+
+  signals:
+    // Emitted after a field's commit has run.
+    void committed(const QObject *field);
+};
+
+#endif // QT_EDIT_COALESCER_H
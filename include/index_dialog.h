@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_INDEX_DIALOG_H
+#define QT_INDEX_DIALOG_H
+
+#include "save_index.h"
+
+#include <QAbstractTableModel>
+#include <QDialog>
+
+#include <future>
+#include <vector>
+
+class QCheckBox;
+class QLabel;
+class QLineEdit;
+class QPushButton;
+class QSpinBox;
+class QTableView;
+
+enum {
+    INDEX_TABLE_SAVE_COL = 0,
+    INDEX_TABLE_SLOT_COL = 1,
+    INDEX_TABLE_SPECIES_COL = 2,
+    INDEX_TABLE_PID_COL = 3,
+    INDEX_TABLE_OT_COL = 4,
+    INDEX_TABLE_IVS_COL = 5,
+    INDEX_TABLE_SHINY_COL = 6,
+    INDEX_TABLE_COLUMN_COUNT = 7,
+};
+
+// Table model over the rows of a save_index matched by a query. Cells are
+// read from the index's columns on demand.
+class index_results_model : public QAbstractTableModel {
+    Q_OBJECT
+    const save_index *index { nullptr };
+    std::vector<u32> rows {};
+
+  public:
+    explicit index_results_model(QObject *parent = nullptr);
+
+    void set_rows(const save_index *, std::vector<u32> rows);
+    QString path_at(int row) const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+};
+
+// Builds and queries the save_index of a directory. Updates run on a worker
+// thread; queries run on the index in memory.
+class index_search_dialog : public QDialog {
+    Q_OBJECT
+    save_index index {};
+    QString index_path {};
+    // Updates decode saves, which needs init_pkedit() to have finished.
+    std::shared_future<void> pkedit_ready {};
+    index_results_model *results { nullptr };
+    QLineEdit *directory_edit { nullptr };
+    QLineEdit *query_edit { nullptr };
+    QCheckBox *recursive_check { nullptr };
+    QSpinBox *jobs_spin { nullptr };
+    QPushButton *update_button { nullptr };
+    QTableView *results_view { nullptr };
+    QLabel *status_label { nullptr };
+    bool updating = false;
+
+    void set_directory(const QString &);
+    void update_index();
+    void run_query();
+
+  public:
+    explicit index_search_dialog(std::shared_future<void> pkedit_ready,
+                                 QWidget *parent = nullptr);
+
+  signals:
+    // The user asked to open the save holding a matched Pokemon.
+    void open_requested(const QString &path);
+};
+
+#endif // QT_INDEX_DIALOG_H
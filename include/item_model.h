@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_ITEM_MODEL_H
+#define QT_ITEM_MODEL_H
+
+#include "save.h"
+#include "trainer.h"
+
+#include <QAbstractTableModel>
+
+#include <memory>
+#include <vector>
+
+enum {
+    ITEM_TABLE_NAME_COL = 0,
+    ITEM_TABLE_QUANTITY_COL = 1,
+    ITEM_TABLE_COLUMN_COUNT = 2,
+};
+
+// Table model over one item pocket of the loaded save. Rows are read straight
+// from the trainer's item vector, so the view can never drift from the save.
+// All modifications of the pocket must go through this model.
+class item_table_model : public QAbstractTableModel {
+    Q_OBJECT
+    pkmn_save *save { nullptr };
+    item_category category;
+
+    const std::vector<std::shared_ptr<item>> &items() const;
+
+  public:
+    explicit item_table_model(item_category, QObject *parent = nullptr);
+
+    // Attaches the model to a save, or detaches it when passed nullptr.
+    // Must be called with nullptr before the save's trainer is freed.
+    void set_save(pkmn_save *);
+    item_category item_type() const noexcept { return category; }
+    const item *item_at(int row) const;
+
+    void add_item(const QString &name, u16 quantity);
+    // Adds an item and moves it to `row`, shifting the rows after it down.
+    void insert_item(int row, const QString &name, u16 quantity);
+    void edit_item(int row, const QString &name, u16 quantity);
+    void del_item(int row);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+};
+
+#endif // QT_ITEM_MODEL_H
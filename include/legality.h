@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_LEGALITY_H
+#define QT_LEGALITY_H
+
+#include "pc_boxes.h"
+#include "pokemon.h"
+#include "save_index.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+struct legality_issue {
+    enum severity : u8 {
+        Warning,
+        Error,
+    };
+
+    // Numbered as in save_index: party slots, then PC box slots.
+    u16 slot { 0 };
+    severity level { Error };
+    const char *check { "" };
+    std::string message {};
+};
+
+// What the checks need to know about a party Pokemon, copied out on the
+// thread that owns the save so that checking can run on any other.
+struct legality_input {
+    indexed_pkmn pkmn {};
+    u8 level { 0 };
+    u32 exp { 0 };
+    u32 min_exp { 0 };
+    u32 max_exp { 0 };
+    bool egg { false };
+    std::array<int, 4> moves {};
+    std::array<int, 4> pp {};
+    std::array<int, 4> max_pp {};
+    usize move_count { 0 };
+    bool has_ability { false };
+    int ability { 0 };
+    // Ability slots the species has.
+    std::array<bool, 3> abilities {};
+    bool has_location { false };
+    bool location_known { true };
+    bool has_level_met { false };
+    int level_met { 0 };
+    bool has_origin { false };
+    int origin_game { 0 };
+    usize origin_count { 0 };
+};
+
+legality_input legality_input_of(const pokemon *, u16 slot);
+
+std::vector<legality_issue> check_party_pkmn(const legality_input &);
+// Checks the 30 slots of `box`. Met locations are checked against the games'
+// own ids, which the boxes store, rather than libpkedit's. Shininess and
+// nature aren't checked: the boxes store neither, only the PID they follow
+// from.
+std::vector<legality_issue> check_gen3_box(const gen3_pc_boxes &, int box);
+
+#endif // QT_LEGALITY_H
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_LEGALITY_PANEL_H
+#define QT_LEGALITY_PANEL_H
+
+#include "legality.h"
+
+#include <QAbstractTableModel>
+#include <QElapsedTimer>
+#include <QWidget>
+
+#include <vector>
+
+class QLabel;
+class QPushButton;
+class QTableView;
+
+enum {
+    LEGALITY_TABLE_SLOT_COL = 0,
+    LEGALITY_TABLE_SEVERITY_COL = 1,
+    LEGALITY_TABLE_CHECK_COL = 2,
+    LEGALITY_TABLE_MESSAGE_COL = 3,
+    LEGALITY_TABLE_COLUMN_COUNT = 4,
+};
+
+// Table model over the issues found so far; batches are appended as the
+// scan's workers finish them.
+class legality_issue_model : public QAbstractTableModel {
+    Q_OBJECT
+    std::vector<legality_issue> issues {};
+
+  public:
+    explicit legality_issue_model(QObject *parent = nullptr);
+
+    void append(const std::vector<legality_issue> &);
+    void clear();
+    const legality_issue &issue_at(int row) const { return issues[row]; }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+};
+
+// Diagnostics panel showing the results of a legality scan as they stream in.
+class legality_panel : public QWidget {
+    Q_OBJECT
+    legality_issue_model *issues { nullptr };
+    QTableView *issues_view { nullptr };
+    QLabel *status_label { nullptr };
+    QPushButton *rescan_button { nullptr };
+    QElapsedTimer clock {};
+
+  public:
+    explicit legality_panel(QWidget *parent = nullptr);
+
+    void begin_scan();
+    void add_issues(const std::vector<legality_issue> &);
+    void finish_scan();
+    void clear();
+
+  signals:
+    void rescan_requested();
+    // The user asked to see the Pokemon in `slot`, numbered as in save_index.
+    void pkmn_requested(u16 slot);
+};
+
+#endif // QT_LEGALITY_PANEL_H
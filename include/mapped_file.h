@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_MAPPED_FILE_H
+#define QT_MAPPED_FILE_H
+
+#include <QByteArray>
+#include <QFile>
+
+#include <memory>
+#include <string>
+
+// A whole file mapped into memory with a private copy-on-write mapping, so
+// that its bytes can be compared, hashed or copied without reading them all
+// up front, and without writes to the view ever reaching the file. Falls
+// back to an owned copy where the file can't be mapped.
+//
+// A private mapping still shows pages that another process rewrites in
+// place until they are first copied, and raises SIGBUS past the end of a
+// file that is truncated meanwhile. Mappings are therefore kept only for as
+// long as one scan or comparison, and destroyed on the thread that made
+// them. Images held for a whole session come from read() instead.
+class mapped_file {
+    std::unique_ptr<QFile> file {};
+    uchar *map { nullptr };
+    QByteArray owned {};
+    QByteArray view {};
+
+    mapped_file() = default;
+
+  public:
+    explicit mapped_file(const QString &path);
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+    ~mapped_file() noexcept;
+
+    // Maps `path`. Throws std::runtime_error if it cannot be read.
+    static std::shared_ptr<const mapped_file> open(const std::string &path);
+    // Reads `path` into an owned copy and closes it before returning, so the
+    // result neither changes with the file nor holds a QFile. Throws
+    // std::runtime_error if it cannot be read.
+    static std::shared_ptr<const mapped_file> read(const std::string &path);
+
+    // The file's contents. The array doesn't own the bytes; it is only valid
+    // while this object is alive.
+    const QByteArray &bytes() const noexcept { return view; }
+    qsizetype size() const noexcept { return view.size(); }
+    bool is_mapped() const noexcept { return map != nullptr; }
+};
+
+#endif // QT_MAPPED_FILE_H
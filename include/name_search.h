@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_NAME_SEARCH_H
+#define QT_NAME_SEARCH_H
+
+#include "save.h"
+
+#include <QHash>
+#include <QObject>
+#include <QStringList>
+
+#include <vector>
+
+class QComboBox;
+class QCompleter;
+class QStringListModel;
+class combo_model_cache;
+
+// Type-ahead index over a static name list. Prefix matches come from a
+// case-folded sorted array (the flat equivalent of a prefix trie), and fuzzy
+// matches from a trigram index of posting lists, so a query only touches the
+// names that share a prefix or trigrams with it.
+class name_search_index {
+    QStringList names;
+    std::vector<QString> folded;
+    // Rows ordered by their folded name.
+    std::vector<int> sorted;
+    // Ascending rows of the names containing each trigram.
+    QHash<quint64, std::vector<int>> trigrams;
+
+  public:
+    explicit name_search_index(const QStringList &names);
+
+    // Rows of the names matching `query`: prefix matches in alphabetical
+    // order, then names containing most of the query's trigrams, best first.
+    std::vector<int> search(const QString &query, usize limit) const;
+    const QString &name(int row) const { return names[row]; }
+};
+
+// Replaces an editable combo box's completer with one that queries the
+// name_search_index of the combo's cached model on every keystroke.
+class combo_name_search : public QObject {
+    Q_OBJECT
+    QComboBox *combo;
+    combo_model_cache &models;
+    QStringListModel *results;
+    QCompleter *completer;
+
+    void update(const QString &text);
+
+  public:
+    static constexpr usize MAX_RESULTS = 50;
+
+    combo_name_search(QComboBox *, combo_model_cache &);
+    // Installs the completer; call again whenever the combo box is made
+    // editable, since that recreates its line edit.
+    void attach();
+};
+
+#endif // QT_NAME_SEARCH_H
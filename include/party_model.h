@@ -0,0 +1,48 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_PARTY_MODEL_H
+#define QT_PARTY_MODEL_H
+
+#include "save.h"
+#include "trainer.h"
+
+#include <QAbstractTableModel>
+
+enum {
+    PKMN_TABLE_NICKNAME_COL = 0,
+    PKMN_TABLE_GENDER_COL = 1,
+    PKMN_TABLE_LEVEL_COL = 2,
+    PKMN_TABLE_SHINY_COL = 3,
+    PKMN_TABLE_EGG_COL = 4,
+    PKMN_TABLE_COLUMN_COUNT = 5,
+};
+
+// Table model over the trainer's party. Cells are read from the Pokemon on
+// demand; editors call refresh() with the cells they may have changed.
+class party_table_model : public QAbstractTableModel {
+    Q_OBJECT
+    pkmn_save *save { nullptr };
+
+  public:
+    explicit party_table_model(QObject *parent = nullptr);
+
+    // Attaches the model to a save, or detaches it when passed nullptr.
+    // Must be called with nullptr before the save's trainer is freed.
+    void set_save(pkmn_save *);
+    pokemon *pokemon_at(int row) const;
+    void refresh(int row, int first_column = PKMN_TABLE_NICKNAME_COL,
+                 int last_column = PKMN_TABLE_EGG_COL);
+    // One dataChanged for every row, after an edit of many Pokemon.
+    void refresh_all(int first_column = PKMN_TABLE_NICKNAME_COL,
+                     int last_column = PKMN_TABLE_EGG_COL);
+    void remove_pkmn(int row);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+};
+
+#endif // QT_PARTY_MODEL_H
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_PC_BOX_MODEL_H
+#define QT_PC_BOX_MODEL_H
+
+#include "pc_boxes.h"
+
+#include <QAbstractTableModel>
+#include <QHash>
+
+#include <list>
+
+enum {
+    PC_BOX_TABLE_DEX_COL = 0,
+    PC_BOX_TABLE_NICKNAME_COL = 1,
+    PC_BOX_TABLE_OT_COL = 2,
+    PC_BOX_TABLE_EXP_COL = 3,
+    PC_BOX_TABLE_SHINY_COL = 4,
+    PC_BOX_TABLE_EGG_COL = 5,
+    PC_BOX_TABLE_COLUMN_COUNT = 6,
+};
+
+// Table model with one row per PC box slot. A slot is decoded the first time
+// one of its cells is painted and kept in a small LRU cache, so scrolling
+// through the boxes only decodes the rows that come into view.
+class pc_box_table_model : public QAbstractTableModel {
+    Q_OBJECT
+    gen3_pc_boxes boxes {};
+    mutable std::list<std::pair<int, boxed_pkmn>> decoded {};
+    mutable QHash<int, std::list<std::pair<int, boxed_pkmn>>::iterator> by_slot {};
+
+    const boxed_pkmn &slot(int) const;
+
+  public:
+    static constexpr usize CACHE_SIZE = 64;
+
+    explicit pc_box_table_model(QObject *parent = nullptr);
+
+    // Shows the boxes stored in `image`. Returns false, leaving the model
+    // empty, for anything other than a Gen 3 save.
+    bool set_image(std::shared_ptr<const mapped_file> image);
+    void clear();
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+};
+
+#endif // QT_PC_BOX_MODEL_H
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_PC_BOXES_H
+#define QT_PC_BOXES_H
+
+#include "mapped_file.h"
+#include "save.h"
+
+#include <QString>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+// A Pokemon stored in a PC box or the party, decoded from the save file's
+// bytes.
+struct boxed_pkmn {
+    bool empty { true };
+    // The stored checksum doesn't match the decrypted data ("Bad Egg").
+    bool corrupt { false };
+    bool egg { false };
+    bool shiny { false };
+    u32 personality_value { 0 };
+    u32 ot_id { 0 };
+    u16 species { 0 };
+    u16 national_dex { 0 };
+    u16 held_item { 0 };
+    u32 exp { 0 };
+    u8 friendship { 0 };
+    std::array<u16, 4> moves {};
+    // HP, Attack, Defense, Speed, Sp. Atk, Sp. Def.
+    std::array<u8, 6> ivs {};
+    std::array<u8, 6> evs {};
+    // The games' own met location id.
+    u8 met_location { 0 };
+    QString nickname {};
+    QString ot_name {};
+};
+
+// Read-only view of the PC boxes of a Gen 3 save file. libpkedit only
+// exposes the party, so the boxes are read from the image directly. Nothing
+// is decoded up front: decode() decrypts a single slot when it is asked for.
+// The party's stored data can be decoded the same way, for callers that need
+// it in the same form as the boxes.
+class gen3_pc_boxes {
+    std::shared_ptr<const mapped_file> image {};
+    // File offset of each PC buffer section (5 to 13) in the active slot.
+    std::array<qsizetype, 9> sections {};
+    // File offset of the party count in the active slot.
+    qsizetype team_size_offset { -1 };
+
+    bool read(usize offset, usize size, uchar *out) const;
+
+  public:
+    static constexpr int BOX_COUNT = 14;
+    static constexpr int SLOTS_PER_BOX = 30;
+    static constexpr int SLOT_COUNT = BOX_COUNT * SLOTS_PER_BOX;
+    static constexpr int PARTY_SLOT_COUNT = 6;
+
+    // Locates the PC buffer of the most recent valid save slot in `image`.
+    // Returns false, leaving the object empty, if neither slot is valid.
+    bool open(std::shared_ptr<const mapped_file> image);
+    void close();
+    bool is_open() const { return image != nullptr; }
+
+    // Decodes `slot`, counted from the first slot of box 1.
+    boxed_pkmn decode(int slot) const;
+    int party_size() const;
+    // Decodes the stored part of party slot `slot`.
+    boxed_pkmn decode_party(int slot) const;
+    // The slot stored at byte `offset` of the image, or -1.
+    int slot_at(qsizetype offset) const;
+    // The slots with bytes stored in [begin, end) of the image, found a
+    // section at a time rather than byte by byte. Slots can repeat.
+    std::vector<int> slots_in(qsizetype begin, qsizetype end) const;
+
+    // Id of the section (0 to 13) whose data holds byte `offset` of a Gen 3
+    // image, or -1 for sector footers and anything that isn't a Gen 3 save.
+    static int section_at(const QByteArray &image, qsizetype offset);
+};
+
+#endif // QT_PC_BOXES_H
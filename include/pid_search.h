@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_PID_SEARCH_H
+#define QT_PID_SEARCH_H
+
+#include "save.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// How a Gen 3 game draws a wild Pokemon from its LCG: two calls for the PID,
+// then two for the IVs, with an unused call skipped in methods 2 and 4.
+enum class rng_method : u8 {
+    // Every PID, with IVs left free.
+    Any_Pid,
+    Method_1,
+    Method_2,
+    Method_4,
+};
+
+enum {
+    PID_SEARCH_ANY = -1,
+    PID_SEARCH_MALE = 0,
+    PID_SEARCH_FEMALE = 1,
+};
+
+// All conditions must hold. IVs are in the order HP, Attack, Defense,
+// Speed, Sp. Atk, Sp. Def.
+struct pid_search_criteria {
+    rng_method method { rng_method::Method_1 };
+    u16 tid { 0 };
+    u16 sid { 0 };
+    bool shiny { false };
+    int nature { PID_SEARCH_ANY };
+    int gender { PID_SEARCH_ANY };
+    // Female if the low byte of the PID is below this: 31, 63, 127 or 191
+    // for species that are 1/8, 1/4, 1/2 or 3/4 female.
+    u8 gender_threshold { 127 };
+    // The PID's low bit picks the first or second ability.
+    int ability { PID_SEARCH_ANY };
+    std::array<u8, 6> iv_min { 0, 0, 0, 0, 0, 0 };
+    std::array<u8, 6> iv_max { 31, 31, 31, 31, 31, 31 };
+    usize max_results { 10000 };
+};
+
+struct pid_search_result {
+    // LCG state before the PID is drawn; equal to the PID for Any_Pid.
+    u32 seed { 0 };
+    u32 pid { 0 };
+    std::array<u8, 6> ivs {};
+};
+
+struct pid_search_progress {
+    // Units of 2^32 / PID_SEARCH_CHUNKS seeds.
+    std::atomic<u32> chunks_done { 0 };
+    std::atomic<usize> found { 0 };
+    std::atomic<bool> cancel { false };
+};
+
+inline constexpr u32 PID_SEARCH_CHUNKS = 4096;
+
+// The Gen 3 LCG, one call forwards or backwards.
+constexpr u32 gen3_lcg_next(u32 state)
+{
+    return state * 0x41C64E6Du + 0x6073u;
+}
+
+constexpr u32 gen3_lcg_prev(u32 state)
+{
+    return state * 0xEEB9EB65u + 0x0A3561A1u;
+}
+
+// The IVs `method` draws after the PID call that left the LCG at `state`.
+// Any_Pid draws none; all IVs are then 0.
+std::array<u8, 6> gen3_method_ivs(rng_method, u32 state);
+
+// Gen 3 PID traits.
+int pid_nature(u32 pid);
+bool pid_shiny(u32 pid, u16 tid, u16 sid);
+int pid_gender(u32 pid, u8 gender_threshold);
+
+// Enumerates all 2^32 seeds (or PIDs) on `jobs` threads (0 means one per
+// hardware thread), handing each chunk's matches to `on_results` from the
+// worker that found them. Stops early once `max_results` are found or
+// `progress.cancel` is set.
+void run_pid_search(const pid_search_criteria &, unsigned jobs, pid_search_progress &progress,
+                    const std::function<void(std::vector<pid_search_result>)> &on_results);
+
+#endif // QT_PID_SEARCH_H
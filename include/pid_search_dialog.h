@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_PID_SEARCH_DIALOG_H
+#define QT_PID_SEARCH_DIALOG_H
+
+#include "pid_search.h"
+
+#include <QAbstractTableModel>
+#include <QDialog>
+#include <QElapsedTimer>
+#include <QFuture>
+#include <QStringList>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+class QCheckBox;
+class QComboBox;
+class QLabel;
+class QProgressBar;
+class QPushButton;
+class QSpinBox;
+class QTableView;
+class QTimer;
+
+enum {
+    PID_TABLE_SEED_COL = 0,
+    PID_TABLE_PID_COL = 1,
+    PID_TABLE_NATURE_COL = 2,
+    PID_TABLE_GENDER_COL = 3,
+    PID_TABLE_ABILITY_COL = 4,
+    PID_TABLE_SHINY_COL = 5,
+    PID_TABLE_IVS_COL = 6,
+    PID_TABLE_COLUMN_COUNT = 7,
+};
+
+// Table model over the matches of a PID search, appended batch by batch.
+class pid_results_model : public QAbstractTableModel {
+    Q_OBJECT
+    std::vector<pid_search_result> results {};
+    pid_search_criteria criteria {};
+    QStringList natures {};
+
+  public:
+    explicit pid_results_model(QStringList natures, QObject *parent = nullptr);
+
+    void reset(const pid_search_criteria &);
+    void append(const std::vector<pid_search_result> &);
+    const pid_search_result &result_at(int row) const { return results[row]; }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+};
+
+// Picker for Gen 3 PIDs and IVs. The search runs on a worker pool and its
+// matches are shown as they are found; a picked match is copied to the
+// clipboard.
+class pid_search_dialog : public QDialog {
+    Q_OBJECT
+    pid_results_model *results { nullptr };
+    QComboBox *method_combo { nullptr };
+    QSpinBox *tid_spin { nullptr };
+    QSpinBox *sid_spin { nullptr };
+    QCheckBox *shiny_check { nullptr };
+    QComboBox *nature_combo { nullptr };
+    QComboBox *gender_combo { nullptr };
+    QComboBox *ratio_combo { nullptr };
+    QComboBox *ability_combo { nullptr };
+    std::array<QSpinBox *, 6> iv_min_spins {};
+    std::array<QSpinBox *, 6> iv_max_spins {};
+    QPushButton *search_button { nullptr };
+    QProgressBar *progress_bar { nullptr };
+    QTableView *results_view { nullptr };
+    QLabel *status_label { nullptr };
+    QTimer *progress_timer { nullptr };
+    QElapsedTimer clock {};
+
+    pid_search_criteria criteria {};
+    std::unique_ptr<pid_search_progress> progress {};
+    QFuture<void> search {};
+
+    pid_search_criteria criteria_from_ui() const;
+    void start_search();
+    void stop_search();
+    void finish_search();
+    // Copies the PID and IVs of result `row` to the clipboard.
+    void copy_result(int row);
+
+  public:
+    // `natures` are the 25 nature names in PID order.
+    explicit pid_search_dialog(const QStringList &natures, QWidget *parent = nullptr);
+    ~pid_search_dialog() override;
+
+    void set_trainer_ids(u16 tid, u16 sid);
+};
+
+#endif // QT_PID_SEARCH_DIALOG_H
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_RECOVERY_JOURNAL_H
+#define QT_RECOVERY_JOURNAL_H
+
+#include "save.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+#include <string>
+#include <vector>
+
+// One edit applied to the loaded save, in the form the editor replays it.
+struct recovery_record {
+    enum op : u8 {
+        Field, // `field` set to `value`
+        Text_Field, // `field` set to `text`
+        Item_Edit, // row `target` of pocket `category` set to `text` x `value`
+        Item_Insert, // `text` x `value` inserted at row `target`
+        Item_Remove, // row `target` removed
+        Party_Remove, // party slot `target` removed
+        Bulk_Edit, // bulk_edit_op `category` with `value` on the party slots in mask `target`
+        Pid_Traits, // party slot `target` given PID `value` by the traits packed in `field`
+    };
+
+    op type { Field };
+    u8 category { 0 };
+    u16 field { 0 };
+    int target { 0 };
+    int value { 0 };
+    QString text {};
+};
+
+// Append-only journal of the edits made since a save was loaded or last
+// written, kept beside it as `<save>.pkedit-journal`. The file is created by
+// the first edit and grows as needed. It is memory mapped and records are
+// copied straight into the mapping, so appending costs no system call while
+// it fits; the kernel writes the pages back even if the process dies.
+//
+// The header stores a hash of the save file the records apply to, so a
+// journal is only offered for replay on top of the exact file it was made
+// against.
+class recovery_journal {
+    QFile file {};
+    uchar *map { nullptr };
+    qint64 mapped_size { 0 };
+    quint32 used { 0 };
+    bool journaling { false };
+    // Written to the header when the file is created.
+    quint32 image_size { 0 };
+    quint64 image_hash { 0 };
+
+    bool remap(qint64 size);
+    bool create() noexcept;
+
+  public:
+    recovery_journal() = default;
+    recovery_journal(const recovery_journal &) = delete;
+    recovery_journal &operator=(const recovery_journal &) = delete;
+    ~recovery_journal() noexcept;
+
+    static QString path_for(const std::string &save_path);
+    // Records left beside `save_path` for the file contents `image`, or none
+    // if there is no journal or it belongs to other contents.
+    static std::vector<recovery_record> read(const std::string &save_path,
+                                             const QByteArray &image);
+
+    // Starts journaling edits to the save at `save_path`, whose contents are
+    // `image`. Records already in a matching journal are kept when
+    // `keep_records` is set; any other journal there is deleted. Returns false
+    // if an existing journal can't be reopened or deleted.
+    bool open(const std::string &save_path, const QByteArray &image, bool keep_records);
+    // Journaling is best effort: if the record can't be written, journaling
+    // stops and the edit is only kept in memory.
+    void append(const recovery_record &) noexcept;
+    bool is_open() const noexcept { return journaling; }
+    // Stops journaling; a journal without records is deleted.
+    void close() noexcept;
+    // Stops journaling and deletes the journal.
+    void remove() noexcept;
+};
+
+#endif // QT_RECOVERY_JOURNAL_H
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_SAVE_DIFF_H
+#define QT_SAVE_DIFF_H
+
+#include "mapped_file.h"
+#include "save.h"
+
+#include <QByteArray>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Parts of a save a byte range can belong to.
+enum : u8 {
+    DIFF_TRAINER = 1 << 0,
+    DIFF_PARTY = 1 << 1,
+    DIFF_ITEMS = 1 << 2,
+    DIFF_BOXES = 1 << 3,
+    DIFF_OTHER = 1 << 4,
+    DIFF_ALL = DIFF_TRAINER | DIFF_PARTY | DIFF_ITEMS | DIFF_BOXES | DIFF_OTHER,
+};
+
+struct byte_range {
+    qsizetype begin { 0 };
+    qsizetype end { 0 };
+};
+
+struct field_change {
+    std::string where {};
+    std::string field {};
+    std::string before {};
+    std::string after {};
+};
+
+struct save_diff {
+    std::vector<byte_range> ranges {};
+    qsizetype bytes_changed { 0 };
+    u8 areas { 0 };
+    std::vector<field_change> changes {};
+    double compare_ms { 0 };
+};
+
+// The runs of bytes that differ between `a` and `b`, compared 16 bytes at a
+// time. Bytes past the end of the shorter image count as changed.
+std::vector<byte_range> diff_bytes(const QByteArray &a, const QByteArray &b);
+
+// The parts of the save that `ranges` touch in either image, each mapped
+// through its own section layout. Only Gen 3 sections are mapped; if either
+// image has another layout, any change gives DIFF_ALL.
+u8 diff_areas(const QByteArray &a, const QByteArray &b, const std::vector<byte_range> &ranges);
+
+// Compares the raw images, then decodes only the parts of the saves that the
+// changed bytes fall in and reports their fields that differ.
+save_diff diff_saves(const pkmn_save &a, const std::shared_ptr<const mapped_file> &image_a,
+                     const pkmn_save &b, const std::shared_ptr<const mapped_file> &image_b);
+
+// "trainer, party" etc., or "none".
+std::string describe_areas(u8 areas);
+
+// Options for comparing saves without the GUI.
+struct diff_options {
+    std::string base {};
+    // A save, or a directory of candidates to rank by distance from `base`.
+    std::string other {};
+    bool recursive { false };
+};
+
+// Returns true if argv asks for --diff, in which case `out` is filled in.
+// Throws std::runtime_error on malformed arguments.
+bool parse_diff_args(int argc, char *argv[], diff_options &out);
+
+// Prints a field-level report, or ranks the candidates. Returns a process
+// exit code.
+int run_diff(const diff_options &opt);
+
+#endif // QT_SAVE_DIFF_H
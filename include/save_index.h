@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_SAVE_INDEX_H
+#define QT_SAVE_INDEX_H
+
+#include "pc_boxes.h"
+#include "pokemon.h"
+#include "save.h"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <variant>
+#include <vector>
+
+enum {
+    // Slots below this are the party; the rest are PC box slots.
+    INDEX_PC_SLOT_BASE = 6,
+    INDEX_NO_NATURE = 0xFF,
+    INDEX_NO_LOCATION = 0xFFFF,
+};
+
+// A Pokemon found in an indexed save. Stats are in the order HP, Attack,
+// Defense, Speed, Sp. Atk, Sp. Def; Gen 1 and 2 store their special DV and
+// stat experience in both special slots.
+//
+// The index decodes the party and boxes of Gen 3 saves from the file, so its
+// Gen 3 rows give the species as a national dex number and the met location
+// as the games' own id. Rows of other generations hold libpkedit's ids.
+struct indexed_pkmn {
+    u16 slot { 0 };
+    u16 species { 0 };
+    u8 generation { 0 };
+    u32 personality_value { 0 };
+    u16 ot_public_id { 0 };
+    u16 ot_secret_id { 0 };
+    std::array<u8, 6> ivs {};
+    std::array<u16, 6> evs {};
+    bool shiny { false };
+    u8 nature { INDEX_NO_NATURE };
+    u16 location { INDEX_NO_LOCATION };
+};
+
+indexed_pkmn index_party_pkmn(const pokemon *, u16 slot);
+// `slot` is counted from the first slot of box 1.
+indexed_pkmn index_boxed_pkmn(const boxed_pkmn &, int slot);
+
+// Columnar index of the Pokemon in a directory of saves: the party through
+// libpkedit and, for Gen 3, the PC boxes. Each field is stored as its own
+// array so that a query only scans the columns it filters on.
+class save_index {
+  public:
+    struct file_entry {
+        std::string path {};
+        std::uint64_t size { 0 };
+        std::int64_t mtime { 0 };
+        std::uint64_t hash { 0 };
+        u32 first { 0 };
+        u32 count { 0 };
+    };
+
+    struct update_stats {
+        usize scanned { 0 };
+        usize reused { 0 };
+        usize extracted { 0 };
+        // "path: reason" for each save that could not be indexed.
+        std::vector<std::string> errors {};
+        double seconds { 0 };
+    };
+
+    static constexpr const char *DEFAULT_FILE_NAME = "pkedit-index.bin";
+
+  private:
+    std::vector<file_entry> files {};
+    std::vector<u32> file_col {};
+    std::vector<u16> slot_col {};
+    std::vector<u16> species_col {};
+    std::vector<u8> generation_col {};
+    std::vector<u32> pid_col {};
+    std::vector<u16> tid_col {};
+    std::vector<u16> sid_col {};
+    std::array<std::vector<u8>, 6> iv_cols {};
+    std::array<std::vector<u16>, 6> ev_cols {};
+    std::vector<u8> shiny_col {};
+    std::vector<u8> nature_col {};
+    std::vector<u16> location_col {};
+
+    using column_ref =
+        std::variant<const std::vector<u8> *, const std::vector<u16> *, const std::vector<u32> *>;
+
+    template <typename Self, typename F> static void visit_columns(Self &, F &&);
+    column_ref column_named(const std::string &) const;
+    void append(u32 file, const indexed_pkmn &);
+
+  public:
+    // Reads an index written by write(). A missing file gives an empty index;
+    // a corrupt one throws std::runtime_error.
+    static save_index load(const std::filesystem::path &);
+    // Replaces `path` atomically. Throws std::runtime_error on failure.
+    void write(const std::filesystem::path &) const;
+
+    // Brings the index in line with the saves under `directory`. Saves whose
+    // size and modification time are unchanged are kept without being read;
+    // the rest are hashed, and only those whose contents changed are decoded
+    // again, by `jobs` threads (0 means one per hardware thread).
+    update_stats update(const std::string &directory, bool recursive, unsigned jobs);
+
+    usize size() const { return slot_col.size(); }
+    const std::vector<file_entry> &indexed_files() const { return files; }
+    const std::string &path_of(u32 row) const { return files[file_col[row]].path; }
+    indexed_pkmn record(u32 row) const;
+
+    // Rows matching every condition of `query`, a space-separated list of
+    // `field<op>value` (op is one of = != < <= > >=) or the bare flags
+    // `shiny`, `party` and `boxed`, e.g. "shiny gen=3 spe_iv=31". Throws
+    // std::runtime_error on a malformed query.
+    std::vector<u32> query(const std::string &query) const;
+    static const char *query_fields();
+
+    // "Party 2" or "Box 3, slot 14".
+    static std::string describe_slot(u16 slot);
+};
+
+// Options for building or querying an index without the GUI.
+struct index_options {
+    std::string directory {};
+    std::string index_file {};
+    std::string query {};
+    unsigned jobs { 0 };
+    bool recursive { false };
+    bool update { false };
+};
+
+// Returns true if argv asks for --index or --query, in which case `out` is
+// filled in. Throws std::runtime_error on malformed arguments.
+bool parse_index_args(int argc, char *argv[], index_options &out);
+
+// Updates and/or queries the index. Returns a process exit code.
+int run_index(const index_options &opt);
+
+#endif // QT_SAVE_INDEX_H
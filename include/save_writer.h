@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_SAVE_WRITER_H
+#define QT_SAVE_WRITER_H
+
+#include "mapped_file.h"
+#include "save.h"
+
+#include <QByteArray>
+
+#include <memory>
+#include <string>
+
+// Writes a save file atomically: libpkedit writes the save into a temporary
+// file next to the destination, which is fsync'd and renamed over the
+// original. An interrupted save leaves either the old or the new file,
+// never a torn one.
+//
+// libpkedit only serializes to a path, so every save writes the whole file
+// once and the writer reads nothing back to compare against. A writer that
+// tracks a file also keeps its image as last read or written, which the box
+// view, the legality scan and the recovery journal work from.
+class save_writer {
+    std::string tracked_path {};
+    std::shared_ptr<const mapped_file> disk_map {};
+
+  public:
+    enum class backup_method : u8 { None, Reflink, Copy };
+
+    struct write_stats {
+        qsizetype bytes_written { 0 };
+        backup_method backup { backup_method::None };
+        double backup_ms { 0 };
+        double save_ms { 0 };
+    };
+
+    // Reads the whole file into an owned copy. The tracked image lives for
+    // the session and is shared with worker threads, so it must not be a
+    // mapping that an emulator's in-place rewrite could change or truncate.
+    // Throws std::runtime_error if it cannot be read.
+    static std::shared_ptr<const mapped_file> read_image(const std::string &path)
+    {
+        return mapped_file::read(path);
+    }
+    static const char *backup_method_name(backup_method method) noexcept;
+
+    void track(const std::string &path, std::shared_ptr<const mapped_file> image);
+    // Contents of the tracked file as last read or written; valid until the
+    // next track(), clear() or write().
+    QByteArray tracked_image() const { return disk_map ? disk_map->bytes() : QByteArray {}; }
+    const std::shared_ptr<const mapped_file> &tracked_map() const { return disk_map; }
+    void clear() noexcept;
+
+    // Serializes `save` (trainer->save() must already have been called) and
+    // writes it to `path`. If a file is tracked, `path` is tracked afterwards
+    // and its image read back; otherwise nothing is read.
+    //
+    // With `backup`, the file as it is on disk before this save is first
+    // copied to `<path>.bak`. The copy replaces any earlier backup only once
+    // it is complete and on disk, the same way as the save. This takes the
+    // place of libpkedit's own backup option, which would only see the
+    // temporary file. Throws std::runtime_error on failure, in which case
+    // `path` is left untouched.
+    write_stats write(const std::string &path, pkmn_save &save, bool backup);
+};
+
+#endif // QT_SAVE_WRITER_H
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_SEED_AUDIT_DIALOG_H
+#define QT_SEED_AUDIT_DIALOG_H
+
+#include "seed_finder.h"
+
+#include <QDialog>
+
+enum {
+    SEED_TABLE_SLOT_COL = 0,
+    SEED_TABLE_PID_COL = 1,
+    SEED_TABLE_IVS_COL = 2,
+    SEED_TABLE_METHOD_COL = 3,
+    SEED_TABLE_SEED_COL = 4,
+    SEED_TABLE_FRAME_COL = 5,
+    SEED_TABLE_COLUMN_COUNT = 6,
+};
+
+// Shows the seeds a seed_audit found, one row per match, and a row for
+// each Pokemon that no method draws.
+class seed_audit_dialog : public QDialog {
+    Q_OBJECT
+
+  public:
+    explicit seed_audit_dialog(const seed_audit &, QWidget *parent = nullptr);
+
+  signals:
+    // The user asked to see the Pokemon in `slot`, numbered as in save_index.
+    void pkmn_requested(u16 slot);
+};
+
+#endif // QT_SEED_AUDIT_DIALOG_H
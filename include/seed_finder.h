@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_SEED_FINDER_H
+#define QT_SEED_FINDER_H
+
+#include "mapped_file.h"
+#include "pid_search.h"
+#include "save_index.h"
+
+#include <QByteArray>
+#include <QString>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+// A way the Gen 3 LCG could have produced a Pokemon's PID and IVs.
+struct seed_match {
+    rng_method method { rng_method::Method_1 };
+    // LCG state before the PID call.
+    u32 seed { 0 };
+    // Calls from seed 0, the boot seed of Emerald and of Ruby and Sapphire
+    // with a dry battery, to `seed`.
+    u32 frame { 0 };
+};
+
+// Calls needed to take the Gen 3 LCG from `from` to `to`.
+u32 gen3_lcg_distance(u32 from, u32 to);
+
+// Recovers the seeds behind Gen 3 PIDs. The PID's low half is the top of
+// the first LCG state and its high half the top of the next, so only the
+// first state's low 16 bits are unknown. The table holds those 65536 values
+// sorted by their product with the LCG multiplier, which turns each lookup
+// into a binary search for the products that carry into the PID's high half.
+class seed_finder {
+    std::shared_ptr<const mapped_file> file {};
+    // The table's bytes, mapped from `file` or, if it couldn't be cached,
+    // owned.
+    QByteArray table {};
+
+  public:
+    static constexpr const char *CACHE_FILE_NAME = "gen3-seed-table.bin";
+
+    // Maps the table cached at `path`, writing it first if it is missing or
+    // stale. If it can't be written, the table is kept in memory instead.
+    static seed_finder open(const QString &path);
+
+    // Whether the table is mapped from its cache file.
+    bool is_cached() const { return file != nullptr; }
+
+    // Every method 1, 2 and 4 seed that draws `pid` and then `ivs`, in
+    // method order.
+    std::vector<seed_match> find(u32 pid, const std::array<u8, 6> &ivs) const;
+};
+
+struct seed_audit_entry {
+    u16 slot { 0 };
+    u32 pid { 0 };
+    std::array<u8, 6> ivs {};
+    // Empty if no method draws this PID and these IVs.
+    std::vector<seed_match> matches {};
+};
+
+struct seed_audit {
+    std::vector<seed_audit_entry> entries {};
+    double table_ms { 0 };
+    double search_ms { 0 };
+    bool cached { false };
+};
+
+// Finds the seeds of the Gen 3 Pokemon in `party` and in the PC boxes of
+// `image`, which are skipped unless it is a Gen 3 save. The table is opened
+// from `table_path`.
+seed_audit audit_seeds(const QString &table_path, const std::vector<indexed_pkmn> &party,
+                       std::shared_ptr<const mapped_file> image);
+
+#endif // QT_SEED_FINDER_H
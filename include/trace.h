@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_TRACE_H
+#define QT_TRACE_H
+
+#include <chrono>
+
+// Scoped timers that are written out as Chrome/Perfetto trace event JSON.
+//
+// Tracing is compiled in when PKEDIT_TRACING is defined (see the
+// PKEDIT_ENABLE_TRACING CMake option) and enabled at runtime by setting the
+// PKEDIT_TRACE environment variable to the output file path. When disabled
+// at runtime a scope costs one branch.
+
+using trace_clock = std::chrono::steady_clock;
+
+bool trace_enabled() noexcept;
+// `name` must outlive the process, i.e. be a string literal.
+void trace_record(const char *name, trace_clock::time_point start,
+                  trace_clock::time_point end) noexcept;
+// Writes every recorded event to the file named by PKEDIT_TRACE.
+void trace_flush() noexcept;
+
+class trace_scope {
+    const char *name { nullptr };
+    trace_clock::time_point start {};
+
+  public:
+    explicit trace_scope(const char *name) noexcept
+    {
+        if (trace_enabled()) {
+            this->name = name;
+            start = trace_clock::now();
+        }
+    }
+    ~trace_scope() noexcept
+    {
+        if (name != nullptr)
+            trace_record(name, start, trace_clock::now());
+    }
+    trace_scope(const trace_scope &) = delete;
+    trace_scope &operator=(const trace_scope &) = delete;
+};
+
+#ifdef PKEDIT_TRACING
+#define PKEDIT_TRACE_CONCAT_(a, b) a##b
+#define PKEDIT_TRACE_CONCAT(a, b) PKEDIT_TRACE_CONCAT_(a, b)
+#define PKEDIT_TRACE_SCOPE(name) const trace_scope PKEDIT_TRACE_CONCAT(trace_scope_, __LINE__)(name)
+#else
+#define PKEDIT_TRACE_SCOPE(name) ((void)0)
+#endif
+
+#endif // QT_TRACE_H
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#ifndef QT_UNDO_JOURNAL_H
+#define QT_UNDO_JOURNAL_H
+
+#include "save.h"
+
+#include <QElapsedTimer>
+#include <QString>
+
+#include <deque>
+#include <vector>
+
+class QObject;
+
+// One reversible editor operation. Only the values that changed are kept;
+// applying a step back to the save is left to the editor.
+struct undo_step {
+    enum kind : u8 {
+        // An editor widget's value: a spin box value, combo box index or check
+        // state, stored in `before`/`after`.
+        Field,
+        // A line edit's text, stored in the journal's text pool.
+        Text_Field,
+        // An edit of a trait derived from the PID (gender, nature, shiny or
+        // ability). `before`/`after` are the PIDs and `text` packs both sets
+        // of traits, since libpkedit re-rolls the PID for each trait.
+        Pid_Traits,
+        // Item rows. `before`/`after` are quantities; the item names are
+        // stored in the text pool.
+        Item_Edit,
+        Item_Insert,
+        Item_Remove,
+    };
+
+    kind type { Field };
+    u8 category { 0 }; // item_category of item steps
+    // Undone and redone together with the step before it.
+    bool joined { false };
+    // Party slot for Pokemon fields, row for item steps, or TRAINER.
+    int target { 0 };
+    QObject *field { nullptr };
+    int before { 0 };
+    int after { 0 };
+    // Index into the text pool, or the traits of Pid_Traits steps.
+    unsigned text { 0 };
+    unsigned time_ms { 0 };
+};
+
+// Linear undo/redo history of compact per-field deltas (32 bytes a step, plus
+// the text of name edits), so thousands of steps take a few hundred KiB.
+// Recording after an undo drops the steps that could have been redone. Steps
+// recorded in a group, such as the fields a bulk edit changed, are undone and
+// redone as one.
+class undo_journal {
+    std::deque<undo_step> steps {};
+    // Before/after text pairs, in the order of the steps that own them.
+    std::deque<QString> texts {};
+    usize text_base { 0 };
+    // steps[0, cursor) are applied.
+    usize cursor { 0 };
+    usize limit;
+    QElapsedTimer clock {};
+    // Recording a group, and whether it has a step yet.
+    bool grouping { false };
+    bool group_started { false };
+
+    void drop_redo_steps();
+    void pop_front_step();
+    void push(undo_step);
+
+  public:
+    static constexpr int TRAINER = -1;
+    static constexpr usize DEFAULT_LIMIT = 10000;
+    // Edits of the same field within this window become a single step.
+    static constexpr unsigned MERGE_WINDOW_MS = 1000;
+
+    explicit undo_journal(usize limit = DEFAULT_LIMIT);
+
+    void record(undo_step step);
+    void record(undo_step step, const QString &before, const QString &after);
+    // Steps recorded between these are one group and are never merged with
+    // other steps.
+    void begin_group() noexcept;
+    void end_group() noexcept;
+
+    // Steps back (or forward) over one step or group and returns the steps to
+    // revert (or reapply) in the order they were recorded, or nothing if
+    // there are none.
+    std::vector<const undo_step *> undo();
+    std::vector<const undo_step *> redo();
+    bool can_undo() const noexcept { return cursor > 0; }
+    bool can_redo() const noexcept { return cursor < steps.size(); }
+
+    const QString &text_before(const undo_step &step) const;
+    const QString &text_after(const undo_step &step) const;
+
+    // Drops the steps of the Pokemon in party slot `slot` and moves those of
+    // later slots up one, as removing it from the party does.
+    void remove_party_slot(int slot);
+    void clear() noexcept;
+    usize size() const noexcept { return steps.size(); }
+    usize memory_usage() const noexcept;
+};
+
+#endif // QT_UNDO_JOURNAL_H
@@ -4,12 +4,36 @@
 #ifndef QT_WINDOW_H
 #define QT_WINDOW_H
 
+#include "bulk_edit.h"
+#include "combo_models.h"
+#include "edit_coalescer.h"
+#include "index_dialog.h"
+#include "item_model.h"
+#include "legality_panel.h"
+#include "party_model.h"
+#include "pc_box_model.h"
+#include "pid_search_dialog.h"
+#include "recovery_journal.h"
 #include "pokemon.h"
 #include "save.h"
+#include "save_writer.h"
+#include "undo_journal.h"
 
 #include <QCheckBox>
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QHash>
 #include <QMainWindow>
-#include <QTableWidget>
+#include <QProgressBar>
+#include <QTableView>
+#include <QVariant>
+
+#include <array>
+#include <future>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include <QComboBox>
 #include <QSpinBox>
@@ -25,37 +49,192 @@ struct options {
     bool allow_illegal_modifications { false };
 };
 
+// Values shown on the stats tab, in the order of the spin boxes that display
+// them. Fields the Pokemon's generation lacks are -1.
+struct stat_view {
+    enum field : u8 {
+        Hp,
+        Atk,
+        Def,
+        Spe,
+        Spa,
+        Spd,
+        Spc,
+        Hp_Iv,
+        Atk_Iv,
+        Def_Iv,
+        Spe_Iv,
+        Spa_Iv,
+        Spd_Iv,
+        Spc_Dv,
+        Hp_Ev,
+        Atk_Ev,
+        Def_Ev,
+        Spe_Ev,
+        Spa_Ev,
+        Spd_Ev,
+        Spc_Ev,
+        Count,
+    };
+    std::array<int, Count> values;
+};
+
+// Table models of one open save. Every model reads the window's `save`, which
+// holds the save of whichever tab is shown, so only the shown tab's models are
+// ever attached to the views.
+struct save_models {
+    party_table_model *party { nullptr };
+    // In the order of the tabs in itemsTabWidget.
+    std::array<item_table_model *, 6> items {};
+    pc_box_table_model *pc_boxes { nullptr };
+};
+
+// A save open in the workspace. The shown save's state lives in the
+// window's own members; the others wait here until their tab is selected,
+// keeping their decoded trainer, undo history and recovery journal. Each
+// keeps its table models, which a switch swaps into the views.
+struct workspace_save {
+    pkmn_save save {};
+    save_writer writer {};
+    undo_journal journal {};
+    std::unique_ptr<recovery_journal> recovery {};
+    bool modified { false };
+    save_models models {};
+};
+
+class QTabBar;
+class QTimer;
+
 class MainWindow : public QMainWindow {
     Q_OBJECT
+    friend class window_bench;
     pkmn_save save {};
     options opt {};
-    QTableWidget *sel_item_table_widget { nullptr };
-    QTableWidget *sel_pkmn_table_widget { nullptr };
+    std::array<item_table_model *, 6> item_models {};
+    combo_model_cache combo_models {};
+    std::vector<combo_name_search *> name_searches {};
+    edit_coalescer *edits { nullptr };
+    QTimer *stats_refresh_timer { nullptr };
+    mutable std::optional<stat_view> shown_stats {};
+    QTableView *sel_item_table_view { nullptr };
+    item_table_model *sel_item_model { nullptr };
+    party_table_model *party_model { nullptr };
+    pc_box_table_model *pc_box_model { nullptr };
+    QTableView *sel_pkmn_table_view { nullptr };
     usize sel_pkmn_table_row { 0 };
     item_category sel_item_category { item_category::Pocket };
     pokemon *sel_pkmn { nullptr };
+    // Shown by the views while no save is open.
+    save_models empty_models {};
     bool save_loaded = false;
+    // Whether the shown save has edits that haven't been written.
+    bool save_modified = false;
+    bool io_in_progress = false;
+    QFuture<void> pending_io {};
+    save_writer writer {};
+    undo_journal journal {};
+    // Editor widgets whose edits are journaled, and the value each showed
+    // after the last commit (the "before" of the next edit).
+    std::vector<QWidget *> trainer_fields {};
+    std::vector<QWidget *> pkmn_fields {};
+    QHash<const QObject *, QVariant> field_values {};
+    // The PID of the Pokemon in the editor at the same point.
+    u32 shown_pid { 0 };
+    bool replaying_undo = false;
+    std::unique_ptr<recovery_journal> recovery { std::make_unique<recovery_journal>() };
+    bool replaying_recovery = false;
+    // One entry per tab of save_tabs; the entry of the shown save is empty.
+    std::vector<workspace_save> workspace {};
+    int shown_save { -1 };
+    QTabBar *save_tabs { nullptr };
+    index_search_dialog *search_dialog { nullptr };
+    legality_panel *legality { nullptr };
+    pid_search_dialog *pid_dialog { nullptr };
+    QFutureWatcher<std::vector<legality_issue>> *legality_watcher { nullptr };
+    std::shared_future<void> pkedit_ready {};
+    QProgressBar *io_progress_bar { nullptr };
     void open_file();
-    void add_pkmn_to_table_widget(QTableWidget *, const pokemon *, int) const;
+    void open_file_path(const QString &);
+    void compare_with_file();
+    void start_legality_scan();
+    void stop_legality_scan();
+    void show_pkmn_in_slot(u16 slot);
+    void open_pid_search();
+    void audit_rng_seeds();
+    void save_file_async(const QString &);
+    void set_loaded_save(const pkmn_save &, const QString &file_name);
+    void park_shown_save();
+    void show_save(int index);
+    void switch_save(int index);
+    void close_save(int index);
+    save_models create_save_models();
+    void use_models(const save_models &);
+    std::array<QTableView *, 6> item_table_views() const;
+    // The tab other than `except` whose file is `path`, or -1.
+    int tab_of_file(const QString &path, int except = -1) const;
+    void populate_ui_from_save();
+    void set_io_in_progress(bool, const QString &);
+    void track_undo_fields();
+    void snapshot_field_values();
+    void record_field_edit(QWidget *, bool trainer_field);
+    void record_item_step(undo_step::kind, item_category, int row, const QString &before_name,
+                          int before_count, const QString &after_name, int after_count);
+    void undo_or_redo(bool redo);
+    void apply_undo_step(const undo_step &, bool redo);
+    void apply_field_value(QWidget *, int target, const QVariant &);
+    // Returns whether the Pokemon ended up with PID `pid`.
+    bool apply_pid_traits(int target, u32 pid, unsigned traits);
+    void select_party_pkmn(int target);
+    // Editor fields whose values libpkedit derives from the PID.
+    std::array<QWidget *, 4> pid_trait_fields() const;
+    void apply_item_step(undo_step::kind, item_category, int row, const QString &name,
+                         int count);
+    void remove_party_pkmn(int row);
+    // The selected party row, or -1 unless exactly one Pokemon is selected.
+    int selected_party_row() const;
+    void bulk_edit_party(bulk_edit_op, int value = 0);
+    // `rows` is a mask of party slots. Errors are reported by party row.
+    bulk_edit_result apply_party_bulk_edit(bulk_edit_op, u32 rows, int value);
+    // The editor fields a bulk edit can change and their values for `pkmn`,
+    // read from the Pokemon rather than through the editor.
+    std::vector<std::pair<QWidget *, QVariant>> bulk_edit_values(const pokemon *);
+    // Journals the fields of `rows` that changed from `before_values` as one
+    // undo step.
+    void record_bulk_edit_steps(
+        const std::vector<int> &rows,
+        const std::vector<std::vector<std::pair<QWidget *, QVariant>>> &before_values);
+    u16 field_id(const QObject *) const;
+    QWidget *field_from_id(u16) const;
+    void log_edit(const recovery_record &) noexcept;
+    void start_recovery_journal(const std::string &path, const QByteArray &image);
+    void replay_recovery_records(const std::vector<recovery_record> &);
+    void update_undo_actions();
+    item_table_model *item_model_for(item_category) const;
     void set_pkmn_in_editor(pokemon *);
-    void add_item_names_to_combo_box(QComboBox *, item_category) const;
+    void add_item_names_to_combo_box(QComboBox *, item_category);
     void update_stats_on_ui(const pokemon *) const;
+    void schedule_stats_refresh();
     void modify_iv(QSpinBox *, pkstat);
     void modify_ev(QSpinBox *, pkstat);
     void block_pkmn_editor_signals(bool) const noexcept;
     void update_pid_on_ui(const pokemon *) const;
     void block_all_signals(bool) const noexcept;
     void set_pkmn_gender_combo_box(const pokemon *) const;
-    void update_party_table_widget() const;
+    void update_party_table_row(int first_column = PKMN_TABLE_NICKNAME_COL,
+                                int last_column = PKMN_TABLE_EGG_COL) const;
     static void reset_spinbox(QSpinBox *);
     static void reset_combo_box(QComboBox *);
+    static void reset_shared_combo_box(QComboBox *);
+    static void set_shared_combo_box_model(QComboBox *, QStringListModel *);
     static void reset_line_edit(QLineEdit *);
-    static void reset_table_widget(QTableWidget *);
+    static void reset_table_view(QTableView *);
     static void reset_checkbox(QCheckBox *);
     void reset_ui();
 
   public:
-    MainWindow(QWidget *parent = nullptr);
+    // `pkedit_ready` becomes ready once init_pkedit() has finished; the window
+    // can be shown before that, but loads wait on it.
+    explicit MainWindow(std::shared_future<void> pkedit_ready, QWidget *parent = nullptr);
     ~MainWindow() noexcept override;
 
   private:
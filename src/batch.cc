@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "batch.h"
+#include "save.h"
+#include "save_writer.h"
+#include "trace.h"
+#include "trainer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+unsigned parse_uint_arg(const char *flag, const char *value, unsigned max)
+{
+    if (value == nullptr)
+        throw std::runtime_error(std::string { flag } + " expects a value");
+
+    try {
+        // std::stoul accepts a sign and wraps "-1" around to ULONG_MAX.
+        if (!std::isdigit(static_cast<unsigned char>(value[0])))
+            throw std::invalid_argument(value);
+        usize pos = 0;
+        const unsigned long n = std::stoul(value, &pos);
+        if (pos != strlen(value) || n > max)
+            throw std::out_of_range(value);
+        return static_cast<unsigned>(n);
+    } catch (const std::exception &) {
+        throw std::runtime_error(std::string { "invalid value for " } + flag + ": " + value);
+    }
+}
+
+bool parse_batch_args(int argc, char *argv[], batch_options &out)
+{
+    bool batch = false;
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *next = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (strcmp(arg, "--batch") == 0) {
+            if (next == nullptr)
+                throw std::runtime_error("--batch expects a directory");
+            out.directory = next;
+            batch = true;
+            ++i;
+        } else if (strcmp(arg, "--jobs") == 0) {
+            out.jobs = parse_uint_arg(arg, next, MAX_JOBS);
+            ++i;
+        } else if (strcmp(arg, "--money") == 0) {
+            out.money = parse_uint_arg(arg, next);
+            ++i;
+        } else if (strcmp(arg, "--coins") == 0) {
+            out.coins = parse_uint_arg(arg, next);
+            ++i;
+        } else if (strcmp(arg, "--no-backup") == 0) {
+            out.backup_save = false;
+        } else if (strcmp(arg, "--recursive") == 0) {
+            out.recursive = true;
+        }
+    }
+
+    return batch;
+}
+
+std::vector<fs::path> collect_save_files(const std::string &directory, bool recursive)
+{
+    std::vector<fs::path> files;
+    auto consider = [&files](const fs::directory_entry &entry) {
+        if (entry.is_regular_file() && entry.path().extension() == ".sav")
+            files.push_back(entry.path());
+    };
+
+    if (recursive) {
+        for (const auto &entry : fs::recursive_directory_iterator(directory))
+            consider(entry);
+    } else {
+        for (const auto &entry : fs::directory_iterator(directory))
+            consider(entry);
+    }
+
+    // Deterministic order so that reports from nightly runs can be compared.
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+static void process_save_file(const fs::path &path, const batch_options &opt)
+{
+    PKEDIT_TRACE_SCOPE("batch::process_save_file");
+    const std::string file_name { path.string() };
+    pkmn_save save { read_pkmn_save_file(file_name.c_str()) };
+
+    try {
+        if (opt.money)
+            save.trainer->set_money(std::min<unsigned>(*opt.money, save.trainer->max_money()));
+        if (opt.coins)
+            save.trainer->set_coins(std::min<unsigned>(*opt.coins, save.trainer->max_coins()));
+
+        // Untracked, so the writer reads nothing back after the write.
+        save_writer writer {};
+        save.trainer->save();
+        writer.write(file_name, save, opt.backup_save);
+    } catch (...) {
+        delete save.trainer;
+        throw;
+    }
+
+    delete save.trainer;
+}
+
+int run_batch(const batch_options &opt)
+{
+    std::vector<fs::path> files;
+    try {
+        files = collect_save_files(opt.directory, opt.recursive);
+    } catch (const std::exception &e) {
+        fprintf(stderr, "batch: unable to read directory %s: %s\n", opt.directory.c_str(),
+                e.what());
+        return EXIT_FAILURE;
+    }
+
+    if (files.empty()) {
+        fprintf(stderr, "batch: no .sav files found in %s\n", opt.directory.c_str());
+        return EXIT_SUCCESS;
+    }
+
+    unsigned jobs = opt.jobs != 0 ? opt.jobs : std::max(1u, std::thread::hardware_concurrency());
+    jobs = std::min<unsigned>(jobs, files.size());
+
+    std::atomic<usize> next { 0 };
+    std::atomic<usize> failed { 0 };
+    std::mutex log_mutex;
+
+    auto worker = [&] {
+        for (usize i = next.fetch_add(1, std::memory_order_relaxed); i < files.size();
+             i = next.fetch_add(1, std::memory_order_relaxed)) {
+            try {
+                process_save_file(files[i], opt);
+            } catch (const std::exception &e) {
+                failed.fetch_add(1, std::memory_order_relaxed);
+                std::lock_guard lock { log_mutex };
+                fprintf(stderr, "batch: %s: %s\n", files[i].string().c_str(), e.what());
+            }
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    pool.reserve(jobs);
+    for (unsigned i = 0; i < jobs; ++i)
+        pool.emplace_back(worker);
+    for (auto &t : pool)
+        t.join();
+    auto end = std::chrono::steady_clock::now();
+
+    const std::chrono::duration<double> elapsed = end - start;
+    const usize ok = files.size() - failed.load();
+    printf("batch: processed %zu file(s), %zu failed, %u worker(s), %.3f s (%.1f files/s)\n",
+           files.size(), failed.load(), jobs, elapsed.count(),
+           elapsed.count() > 0 ? ok / elapsed.count() : 0.0);
+
+    return failed.load() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "bulk_edit.h"
+#include "trace.h"
+
+#include <chrono>
+#include <span>
+#include <stdexcept>
+
+const char *bulk_edit_name(bulk_edit_op op)
+{
+    switch (op) {
+        default:
+            return "Bulk edit";
+        case bulk_edit_op::Max_Ivs:
+            return "Max IVs";
+        case bulk_edit_op::Reset_Evs:
+            return "Reset EVs";
+        case bulk_edit_op::Restore_Pp:
+            return "Restore PP";
+        case bulk_edit_op::Heal_Status:
+            return "Heal status";
+        case bulk_edit_op::Set_Level:
+            return "Set level";
+        case bulk_edit_op::Trade_Evolve:
+            return "Trade evolve";
+    }
+}
+
+// The stats the editor shows IVs and EVs for. Gen 1 and 2 have no separate
+// Sp. Atk and Sp. Def values.
+static std::span<const pkstat> editable_stats(const pokemon *pkmn)
+{
+    static constexpr pkstat stats[] { pkstat::Hp,  pkstat::Atk, pkstat::Def,
+                                      pkstat::Spe, pkstat::Spa, pkstat::Spd };
+    return { stats, pkmn->compat_has_spc_eviv() ? 4u : 6u };
+}
+
+static void require(bool allowed, bool allow_illegal, const char *error)
+{
+    if (!(allowed | allow_illegal))
+        throw std::runtime_error(error);
+}
+
+// Returns false if the edit does not apply to `pkmn`.
+static bool apply(pokemon *pkmn, bulk_edit_op op, int value, bool allow_illegal)
+{
+    pkmn->allow_illegal_changes(allow_illegal);
+    const pkmn_allowed_set_fields *allow = pkmn->allowed_modifications();
+    switch (op) {
+        default:
+            throw std::runtime_error("invalid bulk edit");
+        case bulk_edit_op::Max_Ivs:
+            require(allow->set_ivs, allow_illegal, "IVs cannot be changed");
+            for (pkstat stat : editable_stats(pkmn))
+                pkmn->set_iv(stat, pkmn->iv_maximum_value());
+            return true;
+        case bulk_edit_op::Reset_Evs:
+            // libpkedit has no separate permission for EVs; its IV one
+            // covers the stored stat values.
+            require(allow->set_ivs, allow_illegal, "EVs cannot be changed");
+            for (pkstat stat : editable_stats(pkmn))
+                pkmn->set_ev(stat, 0);
+            return true;
+        case bulk_edit_op::Restore_Pp:
+            require(allow->set_moveset, allow_illegal, "PP cannot be changed");
+            if (pkmn->move1() != 0)
+                pkmn->set_move1_pp(pkmn->move1_max_pp());
+            if (pkmn->move2() != 0)
+                pkmn->set_move2_pp(pkmn->move2_max_pp());
+            if (pkmn->move3() != 0)
+                pkmn->set_move3_pp(pkmn->move3_max_pp());
+            if (pkmn->move4() != 0)
+                pkmn->set_move4_pp(pkmn->move4_max_pp());
+            return true;
+        case bulk_edit_op::Heal_Status:
+            if (pkmn->status() == status_condition::HEALTHY)
+                return false;
+            pkmn->set_status(status_condition::HEALTHY);
+            return true;
+        case bulk_edit_op::Set_Level:
+            pkmn->set_level(value);
+            return true;
+        case bulk_edit_op::Trade_Evolve:
+            if (!pkmn->has_trade_evolution())
+                return false;
+            require(allow->set_species, allow_illegal, "Species cannot be changed");
+            pkmn->simulate_trade_evolution();
+            return true;
+    }
+}
+
+bulk_edit_result apply_bulk_edit(const std::vector<pokemon *> &targets, bulk_edit_op op, int value,
+                                 bool allow_illegal_modifications)
+{
+    PKEDIT_TRACE_SCOPE("apply_bulk_edit");
+    bulk_edit_result result {};
+    const auto start = std::chrono::steady_clock::now();
+    for (usize i = 0; i < targets.size(); ++i) {
+        try {
+            if (apply(targets[i], op, value, allow_illegal_modifications))
+                ++result.changed;
+        } catch (const std::exception &e) {
+            result.errors.push_back({ i, e.what() });
+        }
+    }
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    result.ms = elapsed.count();
+    return result;
+}
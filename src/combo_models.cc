@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "combo_models.h"
+#include "trainer.h"
+
+#include <span>
+
+template <typename Producer>
+QStringListModel *combo_model_cache::get(list_kind kind, u8 key, Producer &&produce,
+                                         const void *owner)
+{
+    cached_list &list = lists[{ kind, key, owner }];
+    if (list.model == nullptr) {
+        const QStringList names { produce() };
+        list.rows.reserve(names.size());
+        for (int row = 0; row < names.size(); ++row)
+            if (!list.rows.contains(names[row]))
+                list.rows.insert(names[row], row);
+        list.model = std::make_unique<QStringListModel>(names);
+        by_model.insert(list.model.get(), &list);
+    }
+    return list.model.get();
+}
+
+QStringListModel *combo_model_cache::species(const pokemon *pkmn)
+{
+    return get(list_kind::Species, pkmn->generation(), [pkmn] {
+        auto all_species { pkmn->species_list() };
+        QStringList names;
+        names.reserve(all_species.size());
+        for (const auto &species : all_species)
+            names.append(QString::fromUtf8(species->name()));
+        return names;
+    });
+}
+
+QStringListModel *combo_model_cache::moves(const pokemon *pkmn)
+{
+    return get(list_kind::Moves, pkmn->generation(), [pkmn] {
+        std::span move_list { pkmn->move_list() };
+        QStringList names;
+        names.reserve(move_list.size());
+        for (const auto &move : move_list)
+            names.append(QString::fromUtf8(move.name));
+        return names;
+    });
+}
+
+QStringListModel *combo_model_cache::items(const pokemon *pkmn, const pkmn_save &save)
+{
+    return get(list_kind::Items, pkmn->generation(), [&save] {
+        std::span item_db { save.trainer->get_all_items() };
+        QStringList names;
+        names.reserve(item_db.size());
+        for (const auto &item : item_db)
+            names.append(QString::fromUtf8(item.name));
+        return names;
+    });
+}
+
+QStringListModel *combo_model_cache::locations(const pokemon *pkmn)
+{
+    return get(list_kind::Locations, pkmn->generation(), [pkmn] {
+        std::span met_locations { pkmn->met_locations_list() };
+        QStringList names;
+        names.reserve(met_locations.size());
+        for (const auto &location : met_locations)
+            names.append(QString::fromUtf8(location.name));
+        return names;
+    });
+}
+
+QStringListModel *combo_model_cache::pocket_items(const pkmn_save &save, item_category category)
+{
+    return get(
+        list_kind::Pocket_Items, static_cast<u8>(category),
+        [&save, category] {
+            QStringList names;
+            for (const auto &name : save.trainer->get_item_names(category))
+                names.append(name);
+            return names;
+        },
+        save.trainer);
+}
+
+int combo_model_cache::row_of(const QStringListModel *model, const QString &name) const
+{
+    const cached_list *list = by_model.value(model);
+    return list != nullptr ? list->rows.value(name, -1) : -1;
+}
+
+const name_search_index *combo_model_cache::search_index(const QStringListModel *model)
+{
+    cached_list *list = by_model.value(model);
+    if (list == nullptr)
+        return nullptr;
+    if (list->search == nullptr)
+        list->search = std::make_unique<name_search_index>(list->model->stringList());
+    return list->search.get();
+}
+
+int combo_model_cache::location_row(const pokemon *pkmn, u16 id)
+{
+    QHash<u16, int> &rows = location_rows[pkmn->generation()];
+    if (rows.isEmpty()) {
+        std::span met_locations { pkmn->met_locations_list() };
+        rows.reserve(met_locations.size());
+        for (usize i = 0; i < met_locations.size(); ++i)
+            if (!rows.contains(met_locations[i].id))
+                rows.insert(met_locations[i].id, static_cast<int>(i));
+    }
+    return rows.value(id, -1);
+}
+
+void combo_model_cache::clear_save_lists(const pkmn_save &save)
+{
+    if (save.trainer == nullptr)
+        return;
+    for (auto it = lists.begin(); it != lists.end();) {
+        if (std::get<const void *>(it->first) != save.trainer) {
+            ++it;
+            continue;
+        }
+        by_model.remove(it->second.model.get());
+        it = lists.erase(it);
+    }
+}
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "diff_dialog.h"
+
+#include <QFileInfo>
+#include <QHeaderView>
+#include <QLabel>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+diff_dialog::diff_dialog(const QString &base, const QString &other, const save_diff &diff,
+                         QWidget *parent)
+    : QDialog(parent)
+{
+    setWindowTitle(QString("%1 vs %2")
+                       .arg(QFileInfo { base }.fileName(), QFileInfo { other }.fileName()));
+    resize(700, 450);
+
+    auto *summary = new QLabel(this);
+    summary->setText(QString("%1 byte(s) changed in %2 range(s) (%3), compared in %4 ms; "
+                             "%5 field(s) differ")
+                         .arg(diff.bytes_changed)
+                         .arg(diff.ranges.size())
+                         .arg(QString::fromStdString(describe_areas(diff.areas)))
+                         .arg(diff.compare_ms, 0, 'f', 3)
+                         .arg(diff.changes.size()));
+
+    auto *table = new QTableWidget(static_cast<int>(diff.changes.size()),
+                                   DIFF_TABLE_COLUMN_COUNT, this);
+    table->setHorizontalHeaderLabels({ "Where", "Field", "Before", "After" });
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setShowGrid(false);
+    table->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    table->horizontalHeader()->setStretchLastSection(true);
+    for (int row = 0; row < table->rowCount(); ++row) {
+        const field_change &change = diff.changes[row];
+        table->setItem(row, DIFF_TABLE_WHERE_COL,
+                       new QTableWidgetItem(QString::fromStdString(change.where)));
+        table->setItem(row, DIFF_TABLE_FIELD_COL,
+                       new QTableWidgetItem(QString::fromStdString(change.field)));
+        table->setItem(row, DIFF_TABLE_BEFORE_COL,
+                       new QTableWidgetItem(QString::fromStdString(change.before)));
+        table->setItem(row, DIFF_TABLE_AFTER_COL,
+                       new QTableWidgetItem(QString::fromStdString(change.after)));
+    }
+
+    auto *layout = new QVBoxLayout(this);
+    layout->addWidget(summary);
+    layout->addWidget(table);
+}
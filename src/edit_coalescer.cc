@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "edit_coalescer.h"
+
+#include <QTimer>
+
+edit_coalescer::edit_coalescer(QObject *parent) : QObject(parent) {}
+
+void edit_coalescer::run(const QObject *field, pending_edit &edit)
+{
+    edit.timer->stop();
+    // Move the commit out first: it may schedule another edit for this field.
+    std::function<void()> commit { std::move(edit.commit) };
+    edit.commit = nullptr;
+    if (commit) {
+        commit();
+        emit committed(field);
+    }
+}
+
+void edit_coalescer::schedule(const QObject *field, int delay_ms, std::function<void()> commit)
+{
+    pending_edit &edit = pending[field];
+    if (edit.timer == nullptr) {
+        edit.timer = new QTimer(this);
+        edit.timer->setSingleShot(true);
+        connect(edit.timer, &QTimer::timeout, this,
+                [this, field] { run(field, pending[field]); });
+    }
+
+    edit.commit = std::move(commit);
+    edit.timer->start(delay_ms);
+}
+
+void edit_coalescer::flush()
+{
+    // Commits may schedule further edits, so don't iterate the hash directly.
+    const QList<const QObject *> fields { pending.keys() };
+    for (const QObject *field : fields) {
+        auto it = pending.find(field);
+        if (it != pending.end() && it->commit)
+            run(field, *it);
+    }
+}
+
+void edit_coalescer::cancel() noexcept
+{
+    for (auto it = pending.begin(); it != pending.end(); ++it) {
+        it->timer->stop();
+        it->commit = nullptr;
+    }
+}
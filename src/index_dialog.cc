@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "index_dialog.h"
+#include "batch.h"
+#include "trace.h"
+
+#include <QCheckBox>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QLineEdit>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QTableView>
+#include <QVBoxLayout>
+#include <QtConcurrent>
+
+#include <chrono>
+#include <filesystem>
+#include <utility>
+
+index_results_model::index_results_model(QObject *parent) : QAbstractTableModel(parent) {}
+
+void index_results_model::set_rows(const save_index *i, std::vector<u32> r)
+{
+    beginResetModel();
+    index = i;
+    rows = std::move(r);
+    endResetModel();
+}
+
+QString index_results_model::path_at(int row) const
+{
+    if (index == nullptr || row < 0 || row >= rowCount())
+        return {};
+    return QString::fromStdString(index->path_of(rows[row]));
+}
+
+int index_results_model::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() || index == nullptr ? 0 : static_cast<int>(rows.size());
+}
+
+int index_results_model::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : INDEX_TABLE_COLUMN_COUNT;
+}
+
+QVariant index_results_model::data(const QModelIndex &i, int role) const
+{
+    if (role != Qt::DisplayRole || !i.isValid() || i.row() >= rowCount())
+        return {};
+
+    const u32 row = rows[i.row()];
+    const indexed_pkmn pkmn { index->record(row) };
+    switch (i.column()) {
+        default:
+            return {};
+        case INDEX_TABLE_SAVE_COL:
+            return QFileInfo { QString::fromStdString(index->path_of(row)) }.fileName();
+        case INDEX_TABLE_SLOT_COL:
+            return QString::fromStdString(save_index::describe_slot(pkmn.slot));
+        case INDEX_TABLE_SPECIES_COL:
+            return static_cast<uint>(pkmn.species);
+        case INDEX_TABLE_PID_COL:
+            return "0x" +
+                   QString::number(pkmn.personality_value, 16).rightJustified(8, '0').toUpper();
+        case INDEX_TABLE_OT_COL:
+            return QStringLiteral("%1/%2").arg(pkmn.ot_public_id).arg(pkmn.ot_secret_id);
+        case INDEX_TABLE_IVS_COL:
+            return QStringLiteral("%1/%2/%3/%4/%5/%6")
+                .arg(pkmn.ivs[0])
+                .arg(pkmn.ivs[1])
+                .arg(pkmn.ivs[2])
+                .arg(pkmn.ivs[3])
+                .arg(pkmn.ivs[4])
+                .arg(pkmn.ivs[5]);
+        case INDEX_TABLE_SHINY_COL:
+            return pkmn.shiny ? QStringLiteral("Yes") : QStringLiteral("No");
+    }
+}
+
+QVariant index_results_model::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole || orientation != Qt::Horizontal)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    switch (section) {
+        default:
+            return {};
+        case INDEX_TABLE_SAVE_COL:
+            return QStringLiteral("Save");
+        case INDEX_TABLE_SLOT_COL:
+            return QStringLiteral("Slot");
+        case INDEX_TABLE_SPECIES_COL:
+            return QStringLiteral("Species");
+        case INDEX_TABLE_PID_COL:
+            return QStringLiteral("PID");
+        case INDEX_TABLE_OT_COL:
+            return QStringLiteral("OT ID/SID");
+        case INDEX_TABLE_IVS_COL:
+            return QStringLiteral("IVs");
+        case INDEX_TABLE_SHINY_COL:
+            return QStringLiteral("Shiny");
+    }
+}
+
+index_search_dialog::index_search_dialog(std::shared_future<void> ready, QWidget *parent)
+    : QDialog(parent), pkedit_ready(std::move(ready))
+{
+    setWindowTitle("Search Saves");
+    resize(800, 500);
+
+    directory_edit = new QLineEdit(this);
+    directory_edit->setReadOnly(true);
+    directory_edit->setPlaceholderText("Directory of saves");
+    auto *browse_button = new QPushButton("Browse...", this);
+    recursive_check = new QCheckBox("Subdirectories", this);
+    recursive_check->setChecked(true);
+    jobs_spin = new QSpinBox(this);
+    jobs_spin->setRange(0, MAX_JOBS);
+    jobs_spin->setSpecialValueText("Auto");
+    jobs_spin->setPrefix("Threads: ");
+    jobs_spin->setToolTip("Threads decoding saves; Auto uses one per hardware thread");
+    update_button = new QPushButton("Update Index", this);
+    update_button->setEnabled(false);
+
+    query_edit = new QLineEdit(this);
+    query_edit->setPlaceholderText("e.g. shiny gen=3 spe_iv=31");
+    query_edit->setToolTip(QString { "Fields: " } + save_index::query_fields());
+
+    results = new index_results_model(this);
+    results_view = new QTableView(this);
+    results_view->setModel(results);
+    results_view->setSelectionBehavior(QAbstractItemView::SelectRows);
+    results_view->setSelectionMode(QAbstractItemView::SingleSelection);
+    results_view->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    results_view->setShowGrid(false);
+    // Fixed row heights keep large result sets from being measured up front.
+    results_view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    status_label = new QLabel(this);
+
+    auto *directory_row = new QHBoxLayout;
+    directory_row->addWidget(directory_edit);
+    directory_row->addWidget(browse_button);
+    directory_row->addWidget(recursive_check);
+    directory_row->addWidget(jobs_spin);
+    directory_row->addWidget(update_button);
+    auto *layout = new QVBoxLayout(this);
+    layout->addLayout(directory_row);
+    layout->addWidget(query_edit);
+    layout->addWidget(results_view);
+    layout->addWidget(status_label);
+
+    connect(browse_button, &QPushButton::clicked, this, [this] {
+        const QString directory { QFileDialog::getExistingDirectory(this, "Directory of Saves") };
+        if (!directory.isEmpty())
+            set_directory(directory);
+    });
+    connect(update_button, &QPushButton::clicked, this, [this] { update_index(); });
+    connect(query_edit, &QLineEdit::returnPressed, this, [this] { run_query(); });
+    connect(results_view, &QTableView::doubleClicked, this, [this](const QModelIndex &i) {
+        const QString path { results->path_at(i.row()) };
+        if (!path.isEmpty())
+            emit open_requested(path);
+    });
+}
+
+void index_search_dialog::set_directory(const QString &directory)
+{
+    if (updating)
+        return;
+
+    directory_edit->setText(directory);
+    index_path = QString::fromStdString(
+        (std::filesystem::path { directory.toStdString() } / save_index::DEFAULT_FILE_NAME)
+            .string());
+    results->set_rows(nullptr, {});
+    try {
+        index = save_index::load(index_path.toStdString());
+        status_label->setText(QString("%1 Pokemon in %2 indexed save(s)")
+                                  .arg(index.size())
+                                  .arg(index.indexed_files().size()));
+    } catch (const std::exception &e) {
+        index = {};
+        status_label->setText(QString { e.what() } + "; update to rebuild it");
+    }
+    update_button->setEnabled(true);
+}
+
+void index_search_dialog::update_index()
+{
+    if (updating || index_path.isEmpty())
+        return;
+
+    struct update_result {
+        save_index index {};
+        save_index::update_stats stats {};
+        QString error {};
+    };
+
+    updating = true;
+    update_button->setEnabled(false);
+    status_label->setText("Indexing " + directory_edit->text() + "...");
+    // The worker updates a copy, so queries keep running on the old index.
+    auto *watcher = new QFutureWatcher<update_result>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher] {
+        update_result result { watcher->result() };
+        watcher->deleteLater();
+        updating = false;
+        update_button->setEnabled(true);
+        if (!result.error.isEmpty()) {
+            status_label->setText(result.error);
+            return;
+        }
+
+        results->set_rows(nullptr, {});
+        index = std::move(result.index);
+        status_label->setText(QString("%1 save(s): %2 unchanged, %3 decoded, %4 failed; "
+                                      "%5 Pokemon, %6 s")
+                                  .arg(result.stats.scanned)
+                                  .arg(result.stats.reused)
+                                  .arg(result.stats.extracted)
+                                  .arg(result.stats.errors.size())
+                                  .arg(index.size())
+                                  .arg(result.stats.seconds, 0, 'f', 2));
+        if (!query_edit->text().isEmpty())
+            run_query();
+    });
+
+    const bool recursive = recursive_check->isChecked();
+    const auto jobs = static_cast<unsigned>(jobs_spin->value());
+    watcher->setFuture(QtConcurrent::run([copy = index, directory = directory_edit->text(),
+                                          path = index_path, recursive, jobs,
+                                          ready = pkedit_ready]() mutable {
+        update_result result {};
+        try {
+            ready.get();
+        } catch (const std::exception &e) {
+            result.error = QString("Error initializing libpkedit: ") + e.what();
+            return result;
+        }
+
+        try {
+            result.stats = copy.update(directory.toStdString(), recursive, jobs);
+            copy.write(path.toStdString());
+            result.index = std::move(copy);
+        } catch (const std::exception &e) {
+            result.error = e.what();
+        }
+        return result;
+    }));
+}
+
+void index_search_dialog::run_query()
+{
+    PKEDIT_TRACE_SCOPE("index_search_dialog::run_query");
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        std::vector<u32> rows { index.query(query_edit->text().toStdString()) };
+        const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+        status_label->setText(QString("%1 of %2 Pokemon matched in %3 ms")
+                                  .arg(rows.size())
+                                  .arg(index.size())
+                                  .arg(elapsed.count(), 0, 'f', 2));
+        results->set_rows(&index, std::move(rows));
+    } catch (const std::exception &e) {
+        results->set_rows(nullptr, {});
+        status_label->setText(e.what());
+    }
+}
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "item_model.h"
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+item_table_model::item_table_model(item_category category, QObject *parent)
+    : QAbstractTableModel(parent), category(category)
+{
+}
+
+const std::vector<std::shared_ptr<item>> &item_table_model::items() const
+{
+    assert(save != nullptr && save->trainer != nullptr);
+    switch (category) {
+        default:
+            throw std::runtime_error("invalid item category");
+        case item_category::Pocket:
+            return save->trainer->get_pocket_items();
+        case item_category::Pokeball:
+            return save->trainer->get_ball_items();
+        case item_category::Berry:
+            return save->trainer->get_berry_case();
+        case item_category::Tm:
+            return save->trainer->get_tm_case();
+        case item_category::Key_Item:
+            return save->trainer->get_key_items();
+        case item_category::Pc:
+            return save->trainer->get_pc_items();
+    }
+}
+
+void item_table_model::set_save(pkmn_save *s)
+{
+    beginResetModel();
+    save = s;
+    endResetModel();
+}
+
+const item *item_table_model::item_at(int row) const
+{
+    if (save == nullptr || row < 0 || row >= rowCount())
+        return nullptr;
+    return items()[row].get();
+}
+
+void item_table_model::add_item(const QString &name, u16 quantity)
+{
+    assert(save != nullptr);
+    const int rows = rowCount();
+    try {
+        save->trainer->add_item(category, name.toStdString().c_str(), quantity);
+    } catch (...) {
+        // The pocket may have changed before libpkedit threw.
+        beginResetModel();
+        endResetModel();
+        throw;
+    }
+
+    // Adding either appends a stack or merges into an existing one depending
+    // on the pocket, which is only known afterwards, so a new row is
+    // announced once it exists.
+    const int now = rowCount();
+    if (now > rows) {
+        beginInsertRows(QModelIndex(), rows, now - 1);
+        endInsertRows();
+        return;
+    }
+    for (int row = 0; row < now; ++row)
+        if (QString::fromUtf8(items()[row]->name()) == name)
+            emit dataChanged(index(row, ITEM_TABLE_NAME_COL), index(row, ITEM_TABLE_QUANTITY_COL));
+}
+
+void item_table_model::insert_item(int row, const QString &name, u16 quantity)
+{
+    assert(save != nullptr);
+    const int rows = rowCount();
+    add_item(name, quantity);
+
+    // libpkedit appends new stacks, so rotate the new last row into place.
+    const int last = rowCount() - 1;
+    if (last < rows || row >= last)
+        return;
+    for (int r = last; r > row; --r) {
+        const item *prev = item_at(r - 1);
+        save->trainer->edit_item(category, r, prev->name(), prev->count());
+    }
+    save->trainer->edit_item(category, row, name.toStdString().c_str(), quantity);
+    emit dataChanged(index(row, ITEM_TABLE_NAME_COL), index(last, ITEM_TABLE_QUANTITY_COL));
+}
+
+void item_table_model::edit_item(int row, const QString &name, u16 quantity)
+{
+    assert(save != nullptr);
+    save->trainer->edit_item(category, row, name.toStdString().c_str(), quantity);
+    emit dataChanged(index(row, ITEM_TABLE_NAME_COL), index(row, ITEM_TABLE_QUANTITY_COL));
+}
+
+void item_table_model::del_item(int row)
+{
+    assert(save != nullptr);
+    if (row < 0 || row >= rowCount())
+        throw std::runtime_error("No item in row " + std::to_string(row));
+
+    beginRemoveRows(QModelIndex(), row, row);
+    try {
+        save->trainer->del_item(category, row);
+    } catch (...) {
+        // The row was valid, so whatever libpkedit left behind is re-read.
+        endRemoveRows();
+        beginResetModel();
+        endResetModel();
+        throw;
+    }
+    endRemoveRows();
+}
+
+int item_table_model::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid() || save == nullptr || save->trainer == nullptr)
+        return 0;
+    return static_cast<int>(items().size());
+}
+
+int item_table_model::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ITEM_TABLE_COLUMN_COUNT;
+}
+
+QVariant item_table_model::data(const QModelIndex &index, int role) const
+{
+    if (role != Qt::DisplayRole || !index.isValid())
+        return {};
+
+    const item *it = item_at(index.row());
+    if (it == nullptr)
+        return {};
+
+    switch (index.column()) {
+        default:
+            return {};
+        case ITEM_TABLE_NAME_COL:
+            return QString::fromUtf8(it->name());
+        case ITEM_TABLE_QUANTITY_COL:
+            return static_cast<uint>(it->count());
+    }
+}
+
+QVariant item_table_model::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole || orientation != Qt::Horizontal)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    switch (section) {
+        default:
+            return {};
+        case ITEM_TABLE_NAME_COL:
+            return QStringLiteral("Name");
+        case ITEM_TABLE_QUANTITY_COL:
+            return QStringLiteral("Quantity");
+    }
+}
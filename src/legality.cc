@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "legality.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+
+// Highest move ID in the Gen 3 games (Psycho Boost).
+static constexpr u16 GEN3_LAST_MOVE = 354;
+static constexpr int MAX_EV_TOTAL = 510;
+// Gen 3 met locations are map sections up to Emerald's last one, or one of
+// the ids the games use for eggs, in-game trades and fateful encounters.
+static constexpr u8 GEN3_MAPSEC_COUNT = 0xD5;
+static constexpr u8 GEN3_FIRST_SPECIAL_LOCATION = 0xFD;
+
+static void report(std::vector<legality_issue> &out, u16 slot, legality_issue::severity level,
+                   const char *check, std::string message)
+{
+    out.push_back({ slot, level, check, std::move(message) });
+}
+
+// The met location ids libpkedit knows for `pkmn`'s generation.
+static std::vector<u16> known_met_locations(const pokemon *pkmn)
+{
+    std::vector<u16> ids;
+    for (const auto &location : std::span { pkmn->met_locations_list() })
+        ids.push_back(location.id);
+    return ids;
+}
+
+legality_input legality_input_of(const pokemon *pkmn, u16 slot)
+{
+    legality_input in {};
+    in.pkmn = index_party_pkmn(pkmn, slot);
+    in.level = static_cast<u8>(pkmn->level());
+    in.exp = pkmn->exp();
+    in.min_exp = pkmn->min_exp();
+    in.max_exp = pkmn->max_exp();
+    in.egg = pkmn->compat_has_egg() && pkmn->is_egg();
+    in.moves = { pkmn->move1(), pkmn->move2(), pkmn->move3(), pkmn->move4() };
+    in.pp = { pkmn->pp1(), pkmn->pp2(), pkmn->pp3(), pkmn->pp4() };
+    in.max_pp = { pkmn->move1_max_pp(), pkmn->move2_max_pp(), pkmn->move3_max_pp(),
+                  pkmn->move4_max_pp() };
+    in.move_count = std::span { pkmn->move_list() }.size();
+
+    in.has_ability = pkmn->compat_has_ability();
+    if (in.has_ability) {
+        const std::array<const char *, 3> abilities { pkmn->abilities() };
+        for (usize i = 0; i < abilities.size(); ++i)
+            in.abilities[i] = strcmp(abilities[i], "_") != 0;
+        in.ability = pkmn->ability_id();
+    }
+
+    in.has_location = pkmn->compat_has_location_met();
+    if (in.has_location) {
+        const std::vector<u16> locations { known_met_locations(pkmn) };
+        in.location_known = std::find(locations.begin(), locations.end(), in.pkmn.location) !=
+                            locations.end();
+    }
+
+    in.has_level_met = pkmn->compat_has_level_met();
+    if (in.has_level_met)
+        in.level_met = pkmn->level_met();
+
+    in.has_origin = pkmn->compat_has_origin();
+    if (in.has_origin) {
+        in.origin_game = pkmn->game_of_origin();
+        in.origin_count = pkmn->origin_games().size();
+    }
+    return in;
+}
+
+template <typename T>
+static void check_moves(std::vector<legality_issue> &out, u16 slot, const std::array<T, 4> &moves,
+                        usize move_count)
+{
+    if (moves[0] == 0)
+        report(out, slot, legality_issue::Error, "Moves", "Has no moves");
+    for (usize i = 0; i < moves.size(); ++i) {
+        if (moves[i] == 0)
+            continue;
+        if (static_cast<usize>(moves[i]) >= move_count)
+            report(out, slot, legality_issue::Error, "Moves",
+                   "Move " + std::to_string(i + 1) + " is unknown (" +
+                       std::to_string(moves[i]) + ")");
+        if (std::find(moves.begin(), moves.begin() + i, moves[i]) != moves.begin() + i)
+            report(out, slot, legality_issue::Error, "Moves",
+                   "Move " + std::to_string(i + 1) + " repeats an earlier move");
+        if (i > 0 && moves[i - 1] == 0)
+            report(out, slot, legality_issue::Warning, "Moves",
+                   "Move " + std::to_string(i + 1) + " follows an empty slot");
+    }
+}
+
+// Checks shared by the party and the boxes.
+static void check_indexed(std::vector<legality_issue> &out, const indexed_pkmn &pkmn)
+{
+    int ev_total = 0;
+    for (u16 ev : pkmn.evs)
+        ev_total += ev;
+    // Gen 1 and 2 stat experience has no total cap.
+    if (pkmn.generation >= 3 && ev_total > MAX_EV_TOTAL)
+        report(out, pkmn.slot, legality_issue::Error, "EVs",
+               "EV total " + std::to_string(ev_total) + " exceeds " +
+                   std::to_string(MAX_EV_TOTAL));
+}
+
+// From Gen 3 on, shininess and (until Gen 5) nature follow from the PID. Only
+// the party has them from elsewhere (libpkedit) to compare with.
+static void check_pid_traits(std::vector<legality_issue> &out, const indexed_pkmn &pkmn)
+{
+    if (pkmn.generation < 3)
+        return;
+    const u32 pid = pkmn.personality_value;
+    const unsigned shiny_value =
+        pkmn.ot_public_id ^ pkmn.ot_secret_id ^ (pid >> 16) ^ (pid & 0xFFFF);
+    const bool pid_shiny = shiny_value < (pkmn.generation >= 6 ? 16u : 8u);
+    if (pid_shiny != pkmn.shiny)
+        report(out, pkmn.slot, legality_issue::Error, "Shiny",
+               pkmn.shiny ? "Marked shiny, but its PID and OT ID make it not shiny"
+                          : "Not marked shiny, but its PID and OT ID make it shiny");
+    if (pkmn.generation <= 4 && pkmn.nature != INDEX_NO_NATURE && pkmn.nature != pid % 25)
+        report(out, pkmn.slot, legality_issue::Error, "Nature",
+               "Nature " + std::to_string(pkmn.nature) + " does not match its PID (" +
+                   std::to_string(pid % 25) + ")");
+}
+
+std::vector<legality_issue> check_party_pkmn(const legality_input &in)
+{
+    std::vector<legality_issue> out;
+    const u16 slot = in.pkmn.slot;
+
+    check_moves(out, slot, in.moves, in.move_count);
+    for (usize i = 0; i < in.moves.size(); ++i)
+        if (in.moves[i] != 0 && in.pp[i] > in.max_pp[i])
+            report(out, slot, legality_issue::Error, "Moves",
+                   "Move " + std::to_string(i + 1) + " has " + std::to_string(in.pp[i]) +
+                       " PP, above its maximum of " + std::to_string(in.max_pp[i]));
+
+    if (in.has_ability &&
+        (in.ability < 0 || in.ability >= static_cast<int>(in.abilities.size()) ||
+         !in.abilities[in.ability]))
+        report(out, slot, legality_issue::Error, "Ability",
+               "The species has no ability in slot " + std::to_string(in.ability + 1));
+
+    if (in.has_location && !in.location_known)
+        report(out, slot, legality_issue::Error, "Met location",
+               "Unknown met location " + std::to_string(in.pkmn.location));
+
+    if (in.has_level_met && in.level_met > in.level)
+        report(out, slot, legality_issue::Error, "Level met",
+               "Met at level " + std::to_string(in.level_met) + ", above its level of " +
+                   std::to_string(in.level));
+
+    if (in.has_origin &&
+        (in.origin_game < 0 || static_cast<usize>(in.origin_game) >= in.origin_count))
+        report(out, slot, legality_issue::Error, "Origin game",
+               "Unknown origin game " + std::to_string(in.origin_game));
+
+    if (in.level < 1 || in.level > 100)
+        report(out, slot, legality_issue::Error, "Level",
+               "Level " + std::to_string(in.level) + " is out of range");
+    else if (in.exp < in.min_exp || in.exp > in.max_exp)
+        report(out, slot, legality_issue::Error, "Exp",
+               std::to_string(in.exp) + " Exp does not match level " + std::to_string(in.level));
+
+    check_indexed(out, in.pkmn);
+    check_pid_traits(out, in.pkmn);
+    return out;
+}
+
+std::vector<legality_issue> check_gen3_box(const gen3_pc_boxes &boxes, int box)
+{
+    PKEDIT_TRACE_SCOPE("check_gen3_box");
+    std::vector<legality_issue> out;
+    const int first = box * gen3_pc_boxes::SLOTS_PER_BOX;
+    for (int slot = first; slot < first + gen3_pc_boxes::SLOTS_PER_BOX; ++slot) {
+        const boxed_pkmn pkmn { boxes.decode(slot) };
+        if (pkmn.empty)
+            continue;
+
+        const auto index_slot = static_cast<u16>(INDEX_PC_SLOT_BASE + slot);
+        if (pkmn.corrupt) {
+            report(out, index_slot, legality_issue::Error, "Checksum",
+                   "Stored checksum does not match its data (Bad Egg)");
+            continue;
+        }
+        if (pkmn.national_dex == 0)
+            report(out, index_slot, legality_issue::Error, "Species",
+                   "Unknown species index " + std::to_string(pkmn.species));
+
+        check_moves(out, index_slot, pkmn.moves, GEN3_LAST_MOVE + 1);
+        if (pkmn.met_location >= GEN3_MAPSEC_COUNT &&
+            pkmn.met_location < GEN3_FIRST_SPECIAL_LOCATION)
+            report(out, index_slot, legality_issue::Error, "Met location",
+                   "Unknown met location " + std::to_string(pkmn.met_location));
+        check_indexed(out, index_boxed_pkmn(pkmn, slot));
+    }
+    return out;
+}
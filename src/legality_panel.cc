@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "legality_panel.h"
+#include "save_index.h"
+
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QTableView>
+#include <QVBoxLayout>
+
+legality_issue_model::legality_issue_model(QObject *parent) : QAbstractTableModel(parent) {}
+
+void legality_issue_model::append(const std::vector<legality_issue> &batch)
+{
+    if (batch.empty())
+        return;
+
+    const int first = rowCount();
+    beginInsertRows({}, first, first + static_cast<int>(batch.size()) - 1);
+    issues.insert(issues.end(), batch.begin(), batch.end());
+    endInsertRows();
+}
+
+void legality_issue_model::clear()
+{
+    beginResetModel();
+    issues.clear();
+    endResetModel();
+}
+
+int legality_issue_model::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(issues.size());
+}
+
+int legality_issue_model::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : LEGALITY_TABLE_COLUMN_COUNT;
+}
+
+QVariant legality_issue_model::data(const QModelIndex &i, int role) const
+{
+    if (role != Qt::DisplayRole || !i.isValid() || i.row() >= rowCount())
+        return {};
+
+    const legality_issue &issue = issues[i.row()];
+    switch (i.column()) {
+        default:
+            return {};
+        case LEGALITY_TABLE_SLOT_COL:
+            return QString::fromStdString(save_index::describe_slot(issue.slot));
+        case LEGALITY_TABLE_SEVERITY_COL:
+            return issue.level == legality_issue::Error ? QStringLiteral("Error")
+                                                        : QStringLiteral("Warning");
+        case LEGALITY_TABLE_CHECK_COL:
+            return QString::fromUtf8(issue.check);
+        case LEGALITY_TABLE_MESSAGE_COL:
+            return QString::fromStdString(issue.message);
+    }
+}
+
+QVariant legality_issue_model::headerData(int section, Qt::Orientation orientation,
+                                          int role) const
+{
+    if (role != Qt::DisplayRole || orientation != Qt::Horizontal)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    switch (section) {
+        default:
+            return {};
+        case LEGALITY_TABLE_SLOT_COL:
+            return QStringLiteral("Slot");
+        case LEGALITY_TABLE_SEVERITY_COL:
+            return QStringLiteral("Severity");
+        case LEGALITY_TABLE_CHECK_COL:
+            return QStringLiteral("Check");
+        case LEGALITY_TABLE_MESSAGE_COL:
+            return QStringLiteral("Problem");
+    }
+}
+
+legality_panel::legality_panel(QWidget *parent) : QWidget(parent)
+{
+    issues = new legality_issue_model(this);
+    issues_view = new QTableView(this);
+    issues_view->setModel(issues);
+    issues_view->setSelectionBehavior(QAbstractItemView::SelectRows);
+    issues_view->setSelectionMode(QAbstractItemView::SingleSelection);
+    issues_view->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    issues_view->setShowGrid(false);
+    issues_view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    issues_view->horizontalHeader()->setStretchLastSection(true);
+    status_label = new QLabel("No save loaded", this);
+    rescan_button = new QPushButton("Rescan", this);
+    rescan_button->setEnabled(false);
+
+    auto *status_row = new QHBoxLayout;
+    status_row->addWidget(status_label, 1);
+    status_row->addWidget(rescan_button);
+    auto *layout = new QVBoxLayout(this);
+    layout->addWidget(issues_view);
+    layout->addLayout(status_row);
+
+    connect(rescan_button, &QPushButton::clicked, this, [this] { emit rescan_requested(); });
+    connect(issues_view, &QTableView::doubleClicked, this,
+            [this](const QModelIndex &i) { emit pkmn_requested(issues->issue_at(i.row()).slot); });
+}
+
+void legality_panel::begin_scan()
+{
+    issues->clear();
+    clock.start();
+    status_label->setText("Checking...");
+    rescan_button->setEnabled(false);
+}
+
+void legality_panel::add_issues(const std::vector<legality_issue> &batch)
+{
+    issues->append(batch);
+    status_label->setText(QString("Checking... %1 issue(s) so far").arg(issues->rowCount()));
+}
+
+void legality_panel::finish_scan()
+{
+    status_label->setText(QString("%1 issue(s) found in %2 ms")
+                              .arg(issues->rowCount())
+                              .arg(clock.elapsed()));
+    rescan_button->setEnabled(true);
+}
+
+void legality_panel::clear()
+{
+    issues->clear();
+    status_label->setText("No save loaded");
+    rescan_button->setEnabled(false);
+}
@@ -1,28 +1,124 @@
 // SPDX-License-Identifier: GPL-3.0
 // Copyright (C) 2025 Abdur-Rahman Mansoor
 
+#include "batch.h"
 #include "init.h"
+#include "save_diff.h"
+#include "save_index.h"
+#include "trace.h"
 #include "window.h"
 
 #include <QApplication>
+#include <QFutureWatcher>
+#include <QTimer>
+#include <QtConcurrent>
+
+#include <chrono>
+#include <cstring>
+#include <future>
 #include <iostream>
 
+using startup_clock = std::chrono::steady_clock;
+
+static double seconds_between(startup_clock::time_point from, startup_clock::time_point to)
+{
+    return std::chrono::duration<double>(to - from).count();
+}
+
 int main(int argc, char *argv[])
 {
-    auto start = std::chrono::high_resolution_clock::now();
+    const auto process_start = startup_clock::now();
+
+    bool startup_profile = false;
+    for (int i = 1; i < argc; ++i)
+        if (strcmp(argv[i], "--startup-profile") == 0)
+            startup_profile = true;
+
+    batch_options batch {};
+    index_options index {};
+    diff_options diff {};
+    bool batch_mode = false;
+    bool index_mode = false;
+    bool diff_mode = false;
     try {
-        init_pkedit();
+        batch_mode = parse_batch_args(argc, argv, batch);
+        index_mode = !batch_mode && parse_index_args(argc, argv, index);
+        diff_mode = !batch_mode && !index_mode && parse_diff_args(argc, argv, diff);
     } catch (const std::exception &e) {
-        fprintf(stderr, "Error initializing libpkedit: %s\n", e.what());
+        fprintf(stderr, "%s\n", e.what());
+        fprintf(stderr,
+                "usage: %s --batch <dir> [--jobs N] [--recursive] [--no-backup] "
+                "[--money N] [--coins N]\n"
+                "       %s [--index <dir>] [--query <query>] [--index-file F] [--jobs N] "
+                "[--recursive]\n"
+                "       %s --diff <save> <save or dir> [--recursive]\n",
+                argv[0], argv[0], argv[0]);
         exit(EXIT_FAILURE);
     }
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> elapsed = end - start;
-    std::cout << "init_pkedit: took " << elapsed.count() << " seconds" << '\n';
+
+    // Set before init_pkedit() runs so that it is defined even if that throws.
+    startup_clock::time_point init_end { process_start };
+    // libpkedit's static tables are not needed to show the window, so build
+    // them while Qt starts up. Anything that touches libpkedit waits on this.
+    std::shared_future<void> pkedit_ready { std::async(std::launch::async, [&init_end] {
+                                                PKEDIT_TRACE_SCOPE("init_pkedit");
+                                                try {
+                                                    init_pkedit();
+                                                } catch (...) {
+                                                    init_end = startup_clock::now();
+                                                    throw;
+                                                }
+                                                init_end = startup_clock::now();
+                                            }).share() };
+
+    if (batch_mode || index_mode || diff_mode) {
+        try {
+            pkedit_ready.get();
+        } catch (const std::exception &e) {
+            fprintf(stderr, "Error initializing libpkedit: %s\n", e.what());
+            exit(EXIT_FAILURE);
+        }
+        if (startup_profile)
+            std::cout << "init_pkedit: " << seconds_between(process_start, init_end) << " s\n";
+        const int status = batch_mode   ? run_batch(batch)
+                           : index_mode ? run_index(index)
+                                        : run_diff(diff);
+        trace_flush();
+        return status;
+    }
 
     QApplication a(argc, argv);
-    MainWindow w;
+    const auto app_end = startup_clock::now();
+    MainWindow w { pkedit_ready };
     w.setWindowTitle("PKEdit");
+    const auto window_end = startup_clock::now();
     w.show();
-    return a.exec();
+
+    if (startup_profile) {
+        QTimer::singleShot(0, &w, [=, &w, &init_end] {
+            const auto first_frame = startup_clock::now();
+            // The report needs init_pkedit's end too; wait for it on a worker
+            // so that the window stays responsive meanwhile.
+            auto *init_watcher = new QFutureWatcher<void>(&w);
+            QObject::connect(init_watcher, &QFutureWatcherBase::finished, &w, [=, &init_end] {
+                init_watcher->deleteLater();
+                std::cout << "startup profile (seconds since process start):\n"
+                          << "  QApplication:        " << seconds_between(process_start, app_end)
+                          << '\n'
+                          << "  MainWindow:          " << seconds_between(app_end, window_end)
+                          << '\n'
+                          << "  show to event loop:  "
+                          << seconds_between(window_end, first_frame) << '\n'
+                          << "  window interactive:  "
+                          << seconds_between(process_start, first_frame) << '\n'
+                          << "  init_pkedit (async): "
+                          << seconds_between(process_start, init_end) << '\n';
+            });
+            init_watcher->setFuture(QtConcurrent::run([pkedit_ready] { pkedit_ready.wait(); }));
+        });
+    }
+
+    const int status = a.exec();
+    trace_flush();
+    return status;
 }
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "mapped_file.h"
+#include "trace.h"
+
+#include <stdexcept>
+
+static std::runtime_error read_error(const QString &path, const QFile &file)
+{
+    return std::runtime_error("Unable to read " + path.toStdString() + ": " +
+                              file.errorString().toStdString());
+}
+
+mapped_file::mapped_file(const QString &path) : file(std::make_unique<QFile>(path))
+{
+    PKEDIT_TRACE_SCOPE("mapped_file::open");
+    if (!file->open(QIODevice::ReadOnly))
+        throw read_error(path, *file);
+
+    const qint64 size = file->size();
+    if (size > 0)
+        map = file->map(0, size, QFileDevice::MapPrivateOption);
+
+    if (map != nullptr) {
+        view = QByteArray::fromRawData(reinterpret_cast<const char *>(map), size);
+    } else {
+        // Pipes, some network filesystems and empty files can't be mapped.
+        owned = file->readAll();
+        view = owned;
+        file.reset();
+    }
+}
+
+mapped_file::~mapped_file() noexcept
+{
+    view.clear();
+    if (map != nullptr)
+        file->unmap(map);
+}
+
+std::shared_ptr<const mapped_file> mapped_file::open(const std::string &path)
+{
+    return std::make_shared<const mapped_file>(QString::fromStdString(path));
+}
+
+std::shared_ptr<const mapped_file> mapped_file::read(const std::string &path)
+{
+    PKEDIT_TRACE_SCOPE("mapped_file::read");
+    const QString name { QString::fromStdString(path) };
+    QFile in { name };
+    if (!in.open(QIODevice::ReadOnly))
+        throw read_error(name, in);
+
+    std::shared_ptr<mapped_file> out { new mapped_file };
+    out->owned = in.readAll();
+    if (in.error() != QFileDevice::NoError)
+        throw read_error(name, in);
+    out->view = out->owned;
+    return out;
+}
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "name_search.h"
+#include "combo_models.h"
+#include "trace.h"
+
+#include <QComboBox>
+#include <QCompleter>
+#include <QLineEdit>
+#include <QStringListModel>
+
+#include <algorithm>
+#include <limits>
+
+static quint64 trigram_key(const QString &s, qsizetype i)
+{
+    return (quint64 { s[i].unicode() } << 32) | (quint64 { s[i + 1].unicode() } << 16) |
+           s[i + 2].unicode();
+}
+
+name_search_index::name_search_index(const QStringList &names) : names(names)
+{
+    PKEDIT_TRACE_SCOPE("name_search_index::build");
+    folded.reserve(names.size());
+    sorted.reserve(names.size());
+    for (int row = 0; row < names.size(); ++row) {
+        folded.push_back(names[row].toLower());
+        sorted.push_back(row);
+
+        const QString &name = folded.back();
+        for (qsizetype i = 0; i + 3 <= name.size(); ++i) {
+            std::vector<int> &rows = trigrams[trigram_key(name, i)];
+            // A name repeating a trigram is listed once.
+            if (rows.empty() || rows.back() != row)
+                rows.push_back(row);
+        }
+    }
+    std::sort(sorted.begin(), sorted.end(), [this](int a, int b) {
+        return folded[a] < folded[b] || (folded[a] == folded[b] && a < b);
+    });
+}
+
+std::vector<int> name_search_index::search(const QString &query, usize limit) const
+{
+    std::vector<int> out;
+    const QString q { query.trimmed().toLower() };
+    if (q.isEmpty() || limit == 0)
+        return out;
+
+    std::vector<bool> taken(folded.size());
+    const auto by_name = [this](int row, const QString &key) { return folded[row] < key; };
+    const auto first = std::lower_bound(sorted.begin(), sorted.end(), q, by_name);
+    for (auto it = first; it != sorted.end() && folded[*it].startsWith(q); ++it) {
+        out.push_back(*it);
+        taken[*it] = true;
+        if (out.size() == limit)
+            return out;
+    }
+
+    if (q.size() < 3)
+        return out;
+
+    // Count the query's distinct trigrams in each name that has any of them.
+    std::vector<quint64> keys;
+    for (qsizetype i = 0; i + 3 <= q.size(); ++i)
+        keys.push_back(trigram_key(q, i));
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    std::vector<u8> hits(folded.size());
+    std::vector<int> candidates;
+    for (quint64 key : keys) {
+        const auto it = trigrams.constFind(key);
+        if (it == trigrams.cend())
+            continue;
+        for (int row : *it) {
+            if (taken[row])
+                continue;
+            if (hits[row] == 0)
+                candidates.push_back(row);
+            if (hits[row] < std::numeric_limits<u8>::max())
+                ++hits[row];
+        }
+    }
+
+    // Tolerate a typo or two: about two thirds of the trigrams must match.
+    const usize threshold = std::max<usize>(1, keys.size() - keys.size() / 3);
+    std::erase_if(candidates, [&](int row) { return hits[row] < threshold; });
+    std::sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+        const bool a_contains = folded[a].contains(q);
+        const bool b_contains = folded[b].contains(q);
+        if (a_contains != b_contains)
+            return a_contains;
+        if (hits[a] != hits[b])
+            return hits[a] > hits[b];
+        return a < b;
+    });
+
+    for (int row : candidates) {
+        if (out.size() == limit)
+            break;
+        out.push_back(row);
+    }
+    return out;
+}
+
+combo_name_search::combo_name_search(QComboBox *combo, combo_model_cache &models)
+    : QObject(combo), combo(combo), models(models), results(new QStringListModel(this)),
+      completer(new QCompleter(results, this))
+{
+    // The results are already filtered and ranked by the index.
+    completer->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    completer->setCaseSensitivity(Qt::CaseInsensitive);
+    completer->setMaxVisibleItems(12);
+    connect(completer, QOverload<const QString &>::of(&QCompleter::activated), this,
+            [this](const QString &name) {
+                const auto *model = qobject_cast<const QStringListModel *>(this->combo->model());
+                const int row = this->models.row_of(model, name);
+                if (row >= 0)
+                    this->combo->setCurrentIndex(row);
+            });
+}
+
+void combo_name_search::attach()
+{
+    QLineEdit *line_edit = combo->lineEdit();
+    if (line_edit == nullptr)
+        return;
+    if (combo->completer() != completer)
+        combo->setCompleter(completer);
+    connect(line_edit, &QLineEdit::textEdited, this, &combo_name_search::update,
+            Qt::UniqueConnection);
+}
+
+void combo_name_search::update(const QString &text)
+{
+    PKEDIT_TRACE_SCOPE("combo_name_search::update");
+    const auto *model = qobject_cast<const QStringListModel *>(combo->model());
+    const name_search_index *index = models.search_index(model);
+    if (index == nullptr)
+        return;
+
+    QStringList matches;
+    for (int row : index->search(text, MAX_RESULTS))
+        matches.append(index->name(row));
+    results->setStringList(matches);
+    if (!matches.isEmpty())
+        completer->complete();
+}
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "party_model.h"
+
+#include <cassert>
+#include <stdexcept>
+
+party_table_model::party_table_model(QObject *parent) : QAbstractTableModel(parent) {}
+
+void party_table_model::set_save(pkmn_save *s)
+{
+    beginResetModel();
+    save = s;
+    endResetModel();
+}
+
+pokemon *party_table_model::pokemon_at(int row) const
+{
+    if (row < 0 || row >= rowCount())
+        return nullptr;
+    return save->trainer->pkmn_team()[row].get();
+}
+
+void party_table_model::refresh(int row, int first_column, int last_column)
+{
+    if (row < 0 || row >= rowCount())
+        return;
+    emit dataChanged(index(row, first_column), index(row, last_column), { Qt::DisplayRole });
+}
+
+void party_table_model::refresh_all(int first_column, int last_column)
+{
+    if (rowCount() == 0)
+        return;
+    emit dataChanged(index(0, first_column), index(rowCount() - 1, last_column),
+                     { Qt::DisplayRole });
+}
+
+void party_table_model::remove_pkmn(int row)
+{
+    assert(save != nullptr);
+    if (save->trainer->pkmn_team().size() <= 1)
+        throw std::runtime_error("Cannot delete last pokemon in party");
+
+    beginRemoveRows(QModelIndex(), row, row);
+    try {
+        save->trainer->remove_pkmn_from_party(row);
+    } catch (...) {
+        endRemoveRows();
+        beginResetModel();
+        endResetModel();
+        throw;
+    }
+    endRemoveRows();
+}
+
+int party_table_model::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid() || save == nullptr || save->trainer == nullptr)
+        return 0;
+    return static_cast<int>(save->trainer->pkmn_team().size());
+}
+
+int party_table_model::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : PKMN_TABLE_COLUMN_COUNT;
+}
+
+QVariant party_table_model::data(const QModelIndex &index, int role) const
+{
+    if (role != Qt::DisplayRole || !index.isValid())
+        return {};
+
+    const pokemon *pkmn = pokemon_at(index.row());
+    if (pkmn == nullptr)
+        return {};
+
+    switch (index.column()) {
+        default:
+            return {};
+        case PKMN_TABLE_NICKNAME_COL:
+            return QString::fromStdWString(pkmn->nickname());
+        case PKMN_TABLE_GENDER_COL:
+            return QString::fromUtf8(pkmn->gender_name());
+        case PKMN_TABLE_LEVEL_COL:
+            return static_cast<uint>(pkmn->level());
+        case PKMN_TABLE_SHINY_COL:
+            return pkmn->is_shiny() ? QStringLiteral("Yes") : QStringLiteral("No");
+        case PKMN_TABLE_EGG_COL:
+            return pkmn->is_egg() ? QStringLiteral("Yes") : QStringLiteral("No");
+    }
+}
+
+QVariant party_table_model::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    if (orientation == Qt::Vertical)
+        return section + 1;
+
+    switch (section) {
+        default:
+            return {};
+        case PKMN_TABLE_NICKNAME_COL:
+            return QStringLiteral("Nickname");
+        case PKMN_TABLE_GENDER_COL:
+            return QStringLiteral("Gender");
+        case PKMN_TABLE_LEVEL_COL:
+            return QStringLiteral("Level");
+        case PKMN_TABLE_SHINY_COL:
+            return QStringLiteral("Shiny");
+        case PKMN_TABLE_EGG_COL:
+            return QStringLiteral("Egg");
+    }
+}
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "pc_box_model.h"
+#include "trace.h"
+
+pc_box_table_model::pc_box_table_model(QObject *parent) : QAbstractTableModel(parent) {}
+
+bool pc_box_table_model::set_image(std::shared_ptr<const mapped_file> image)
+{
+    beginResetModel();
+    decoded.clear();
+    by_slot.clear();
+    const bool opened = boxes.open(std::move(image));
+    endResetModel();
+    return opened;
+}
+
+void pc_box_table_model::clear()
+{
+    beginResetModel();
+    boxes.close();
+    decoded.clear();
+    by_slot.clear();
+    endResetModel();
+}
+
+const boxed_pkmn &pc_box_table_model::slot(int row) const
+{
+    if (auto it = by_slot.constFind(row); it != by_slot.cend()) {
+        decoded.splice(decoded.begin(), decoded, *it);
+        return decoded.front().second;
+    }
+
+    PKEDIT_TRACE_SCOPE("pc_box_table_model::decode");
+    if (decoded.size() == CACHE_SIZE) {
+        by_slot.remove(decoded.back().first);
+        decoded.pop_back();
+    }
+    decoded.emplace_front(row, boxes.decode(row));
+    by_slot.insert(row, decoded.begin());
+    return decoded.front().second;
+}
+
+int pc_box_table_model::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid() || !boxes.is_open())
+        return 0;
+    return gen3_pc_boxes::SLOT_COUNT;
+}
+
+int pc_box_table_model::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : PC_BOX_TABLE_COLUMN_COUNT;
+}
+
+QVariant pc_box_table_model::data(const QModelIndex &index, int role) const
+{
+    if (role != Qt::DisplayRole || !index.isValid() || index.row() >= rowCount())
+        return {};
+
+    const boxed_pkmn &pkmn = slot(index.row());
+    if (pkmn.empty)
+        return {};
+    if (pkmn.corrupt)
+        return index.column() == PC_BOX_TABLE_NICKNAME_COL ? QStringLiteral("Bad Egg")
+                                                           : QVariant {};
+
+    switch (index.column()) {
+        default:
+            return {};
+        case PC_BOX_TABLE_DEX_COL:
+            return static_cast<uint>(pkmn.national_dex);
+        case PC_BOX_TABLE_NICKNAME_COL:
+            return pkmn.nickname;
+        case PC_BOX_TABLE_OT_COL:
+            return pkmn.ot_name;
+        case PC_BOX_TABLE_EXP_COL:
+            return static_cast<uint>(pkmn.exp);
+        case PC_BOX_TABLE_SHINY_COL:
+            return pkmn.shiny ? QStringLiteral("Yes") : QStringLiteral("No");
+        case PC_BOX_TABLE_EGG_COL:
+            return pkmn.egg ? QStringLiteral("Yes") : QStringLiteral("No");
+    }
+}
+
+QVariant pc_box_table_model::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    if (orientation == Qt::Vertical)
+        return QStringLiteral("Box %1 #%2")
+            .arg(section / gen3_pc_boxes::SLOTS_PER_BOX + 1)
+            .arg(section % gen3_pc_boxes::SLOTS_PER_BOX + 1);
+
+    switch (section) {
+        default:
+            return {};
+        case PC_BOX_TABLE_DEX_COL:
+            return QStringLiteral("Dex No.");
+        case PC_BOX_TABLE_NICKNAME_COL:
+            return QStringLiteral("Nickname");
+        case PC_BOX_TABLE_OT_COL:
+            return QStringLiteral("OT");
+        case PC_BOX_TABLE_EXP_COL:
+            return QStringLiteral("Exp");
+        case PC_BOX_TABLE_SHINY_COL:
+            return QStringLiteral("Shiny");
+        case PC_BOX_TABLE_EGG_COL:
+            return QStringLiteral("Egg");
+    }
+}
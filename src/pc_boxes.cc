@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "pc_boxes.h"
+
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <optional>
+
+// Save layout: two slots of 14 sectors, each sector holding 3968 bytes of
+// data and a footer identifying it. Sectors within a slot are rotated on
+// every save, so sections are found by id.
+enum : usize {
+    SECTOR_SIZE = 0x1000,
+    SECTOR_DATA_SIZE = 3968,
+    SECTORS_PER_SLOT = 14,
+    SLOT_SIZE = SECTOR_SIZE * SECTORS_PER_SLOT,
+    FOOTER_SECTION_ID = 0xFF4,
+    FOOTER_SIGNATURE = 0xFF8,
+    FOOTER_SAVE_INDEX = 0xFFC,
+    TRAINER_SECTION = 0,
+    TEAM_SECTION = 1,
+    FIRST_PC_SECTION = 5,
+    LAST_PC_SECTION = 13,
+    // The PC buffer starts with the current box number.
+    PC_SLOTS_OFFSET = 4,
+    BOX_PKMN_SIZE = 80,
+    // Game code in the trainer section: 0 for Ruby and Sapphire, 1 for
+    // FireRed and LeafGreen, and Emerald's security key otherwise.
+    GAME_CODE_OFFSET = 0xAC,
+    GAME_CODE_FRLG = 1,
+    // The party count, followed by the party, in the team section.
+    TEAM_SIZE_OFFSET_RSE = 0x234,
+    TEAM_SIZE_OFFSET_FRLG = 0x34,
+    // A party Pokemon is a boxed one followed by its battle stats.
+    PARTY_PKMN_SIZE = 100,
+    SECURE_OFFSET = 32,
+    SECURE_SIZE = 48,
+    SUBSTRUCT_SIZE = 12,
+};
+
+static constexpr u32 SECTOR_SIGNATURE = 0x08012025;
+
+// Position of the growth, attacks, EVs and misc substructures for each value
+// of personality % 24.
+static constexpr u8 SUBSTRUCT_ORDER[24][4] = {
+    { 0, 1, 2, 3 }, { 0, 1, 3, 2 }, { 0, 2, 1, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 },
+    { 0, 3, 2, 1 }, { 1, 0, 2, 3 }, { 1, 0, 3, 2 }, { 2, 0, 1, 3 }, { 3, 0, 1, 2 },
+    { 2, 0, 3, 1 }, { 3, 0, 2, 1 }, { 1, 2, 0, 3 }, { 1, 3, 0, 2 }, { 2, 1, 0, 3 },
+    { 3, 1, 0, 2 }, { 2, 3, 0, 1 }, { 3, 2, 0, 1 }, { 1, 2, 3, 0 }, { 1, 3, 2, 0 },
+    { 2, 1, 3, 0 }, { 3, 1, 2, 0 }, { 2, 3, 1, 0 }, { 3, 2, 1, 0 },
+};
+
+// National dex numbers of the Hoenn species, which Gen 3 stores in its own
+// order starting at index 277. Indices 252 to 276 are unused.
+static constexpr u16 HOENN_NATIONAL_DEX[] = {
+    252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+    270, 271, 272, 273, 274, 275, 290, 291, 292, 276, 277, 285, 286, 327, 278, 279, 283, 284,
+    320, 321, 300, 301, 352, 343, 344, 299, 324, 302, 339, 340, 370, 341, 342, 349, 350, 318,
+    319, 328, 329, 330, 296, 297, 309, 310, 322, 323, 363, 364, 365, 331, 332, 361, 362, 337,
+    338, 298, 325, 326, 311, 312, 303, 307, 308, 333, 334, 360, 355, 356, 315, 287, 288, 289,
+    316, 317, 357, 293, 294, 295, 366, 367, 368, 359, 353, 354, 336, 335, 369, 304, 305, 306,
+    351, 313, 314, 345, 346, 347, 348, 280, 281, 282, 371, 372, 373, 374, 375, 376, 377, 378,
+    379, 382, 383, 384, 380, 381, 385, 386, 358,
+};
+
+static u16 national_dex_number(u16 species)
+{
+    if (species < 252)
+        return species;
+    if (species < 277 || species - 277 >= std::size(HOENN_NATIONAL_DEX))
+        return 0;
+    return HOENN_NATIONAL_DEX[species - 277];
+}
+
+// Decodes the English character set; other characters show as '?'.
+static QString decode_text(const uchar *text, usize size)
+{
+    QString out;
+    for (usize i = 0; i < size && text[i] != 0xFF; ++i) {
+        const uchar c = text[i];
+        if (c >= 0xBB && c <= 0xD4)
+            out += QChar('A' + (c - 0xBB));
+        else if (c >= 0xD5 && c <= 0xEE)
+            out += QChar('a' + (c - 0xD5));
+        else if (c >= 0xA1 && c <= 0xAA)
+            out += QChar('0' + (c - 0xA1));
+        else if (c == 0x00)
+            out += u' ';
+        else if (c == 0xAB)
+            out += u'!';
+        else if (c == 0xAD)
+            out += u'.';
+        else if (c == 0xAE)
+            out += u'-';
+        else if (c == 0xB4)
+            out += u'’';
+        else if (c == 0xB5)
+            out += u'♂';
+        else if (c == 0xB6)
+            out += u'♀';
+        else
+            out += u'?';
+    }
+    return out;
+}
+
+// Finds the sections of save slot `slot`, by id. Returns false if any of its
+// sectors fails the signature check or a section is missing.
+static bool find_sections(const uchar *data, usize slot,
+                          std::array<qsizetype, SECTORS_PER_SLOT> &sections)
+{
+    sections.fill(-1);
+    for (usize sector = 0; sector < SECTORS_PER_SLOT; ++sector) {
+        const usize offset = slot * SLOT_SIZE + sector * SECTOR_SIZE;
+        const uchar *footer = data + offset;
+        const u16 id = qFromLittleEndian<u16>(footer + FOOTER_SECTION_ID);
+        if (qFromLittleEndian<u32>(footer + FOOTER_SIGNATURE) != SECTOR_SIGNATURE)
+            return false;
+        if (id < SECTORS_PER_SLOT)
+            sections[id] = static_cast<qsizetype>(offset);
+    }
+    return std::none_of(sections.begin(), sections.end(),
+                        [](qsizetype offset) { return offset < 0; });
+}
+
+bool gen3_pc_boxes::open(std::shared_ptr<const mapped_file> file)
+{
+    close();
+    if (file == nullptr || static_cast<usize>(file->size()) < 2 * SLOT_SIZE)
+        return false;
+
+    // As the game does, a slot that fails validation (e.g. one interrupted
+    // while being written) is skipped in favour of the other.
+    const uchar *data = reinterpret_cast<const uchar *>(file->bytes().constData());
+    std::optional<u32> active_index {};
+    std::array<qsizetype, SECTORS_PER_SLOT> active {};
+    for (usize slot = 0; slot < 2; ++slot) {
+        std::array<qsizetype, SECTORS_PER_SLOT> slot_sections {};
+        if (!find_sections(data, slot, slot_sections))
+            continue;
+        const u32 index = qFromLittleEndian<u32>(data + slot * SLOT_SIZE + FOOTER_SAVE_INDEX);
+        if (!active_index || index > *active_index) {
+            active_index = index;
+            active = slot_sections;
+        }
+    }
+    if (!active_index)
+        return false;
+
+    std::copy(active.begin() + FIRST_PC_SECTION, active.end(), sections.begin());
+    const bool frlg =
+        qFromLittleEndian<u32>(data + active[TRAINER_SECTION] + GAME_CODE_OFFSET) == GAME_CODE_FRLG;
+    team_size_offset =
+        active[TEAM_SECTION] + (frlg ? TEAM_SIZE_OFFSET_FRLG : TEAM_SIZE_OFFSET_RSE);
+
+    image = std::move(file);
+    return true;
+}
+
+void gen3_pc_boxes::close()
+{
+    image.reset();
+    sections.fill(-1);
+    team_size_offset = -1;
+}
+
+bool gen3_pc_boxes::read(usize offset, usize size, uchar *out) const
+{
+    // Box slots straddle section boundaries, so copy section by section.
+    const char *data = image->bytes().constData();
+    while (size > 0) {
+        const usize section = offset / SECTOR_DATA_SIZE;
+        if (section >= sections.size())
+            return false;
+        const usize within = offset % SECTOR_DATA_SIZE;
+        const usize n = std::min(size, SECTOR_DATA_SIZE - within);
+        memcpy(out, data + sections[section] + within, n);
+        out += n;
+        offset += n;
+        size -= n;
+    }
+    return true;
+}
+
+int gen3_pc_boxes::slot_at(qsizetype offset) const
+{
+    for (usize section = 0; section < sections.size(); ++section) {
+        if (offset < sections[section] ||
+            offset >= sections[section] + static_cast<qsizetype>(SECTOR_DATA_SIZE))
+            continue;
+        const usize pc_offset = section * SECTOR_DATA_SIZE + (offset - sections[section]);
+        if (pc_offset < PC_SLOTS_OFFSET)
+            return -1;
+        const usize slot = (pc_offset - PC_SLOTS_OFFSET) / BOX_PKMN_SIZE;
+        return slot < SLOT_COUNT ? static_cast<int>(slot) : -1;
+    }
+    return -1;
+}
+
+std::vector<int> gen3_pc_boxes::slots_in(qsizetype begin, qsizetype end) const
+{
+    std::vector<int> out;
+    for (usize section = 0; section < sections.size(); ++section) {
+        const qsizetype data_begin = std::max(begin, sections[section]);
+        const qsizetype data_end =
+            std::min(end, sections[section] + static_cast<qsizetype>(SECTOR_DATA_SIZE));
+        if (data_begin >= data_end)
+            continue;
+        // The first and last PC buffer bytes in this section, then the slots
+        // they belong to.
+        const usize first = section * SECTOR_DATA_SIZE + (data_begin - sections[section]);
+        const usize last = section * SECTOR_DATA_SIZE + (data_end - 1 - sections[section]);
+        if (last < PC_SLOTS_OFFSET)
+            continue;
+        const usize first_slot =
+            (std::max<usize>(first, PC_SLOTS_OFFSET) - PC_SLOTS_OFFSET) / BOX_PKMN_SIZE;
+        const usize last_slot =
+            std::min<usize>((last - PC_SLOTS_OFFSET) / BOX_PKMN_SIZE, SLOT_COUNT - 1);
+        for (usize slot = first_slot; slot <= last_slot; ++slot)
+            out.push_back(static_cast<int>(slot));
+    }
+    return out;
+}
+
+int gen3_pc_boxes::section_at(const QByteArray &image, qsizetype offset)
+{
+    if (offset < 0 || static_cast<usize>(image.size()) < 2 * SLOT_SIZE ||
+        static_cast<usize>(offset) >= 2 * SLOT_SIZE || offset % SECTOR_SIZE >= SECTOR_DATA_SIZE)
+        return -1;
+
+    const uchar *footer = reinterpret_cast<const uchar *>(image.constData()) +
+                          (offset / SECTOR_SIZE) * SECTOR_SIZE;
+    if (qFromLittleEndian<u32>(footer + FOOTER_SIGNATURE) != SECTOR_SIGNATURE)
+        return -1;
+    const u16 id = qFromLittleEndian<u16>(footer + FOOTER_SECTION_ID);
+    return id < SECTORS_PER_SLOT ? id : -1;
+}
+
+// Decrypts and decodes the 80 bytes of a stored Pokemon, in place.
+static boxed_pkmn decode_pkmn(uchar *raw)
+{
+    boxed_pkmn out {};
+    out.personality_value = qFromLittleEndian<u32>(raw);
+    out.ot_id = qFromLittleEndian<u32>(raw + 4);
+    // bit 1 of the flags byte is set for occupied slots.
+    if ((raw[19] & 0x2) == 0 && out.personality_value == 0 && out.ot_id == 0)
+        return out;
+    out.empty = false;
+
+    // The substructures are XORed word by word with the personality value
+    // and OT ID, and guarded by a 16-bit sum of the decrypted data.
+    uchar *secure = raw + SECURE_OFFSET;
+    const u32 key = out.personality_value ^ out.ot_id;
+    u16 checksum = 0;
+    for (usize i = 0; i < SECURE_SIZE; i += 4) {
+        const u32 word = qFromLittleEndian<u32>(secure + i) ^ key;
+        qToLittleEndian(word, secure + i);
+        checksum += static_cast<u16>(word) + static_cast<u16>(word >> 16);
+    }
+    out.corrupt = checksum != qFromLittleEndian<u16>(raw + 28) || (raw[19] & 0x1) != 0;
+
+    const u8 *order = SUBSTRUCT_ORDER[out.personality_value % 24];
+    const uchar *growth = secure + order[0] * SUBSTRUCT_SIZE;
+    const uchar *attacks = secure + order[1] * SUBSTRUCT_SIZE;
+    const uchar *evs = secure + order[2] * SUBSTRUCT_SIZE;
+    const uchar *misc = secure + order[3] * SUBSTRUCT_SIZE;
+
+    out.species = qFromLittleEndian<u16>(growth);
+    out.national_dex = national_dex_number(out.species);
+    out.held_item = qFromLittleEndian<u16>(growth + 2);
+    out.exp = qFromLittleEndian<u32>(growth + 4);
+    out.friendship = growth[9];
+    for (usize i = 0; i < out.moves.size(); ++i)
+        out.moves[i] = qFromLittleEndian<u16>(attacks + 2 * i);
+
+    std::copy_n(evs, out.evs.size(), out.evs.begin());
+    out.met_location = misc[1];
+
+    const u32 iv_egg_ability = qFromLittleEndian<u32>(misc + 4);
+    for (usize i = 0; i < out.ivs.size(); ++i)
+        out.ivs[i] = (iv_egg_ability >> (5 * i)) & 0x1F;
+    out.egg = (iv_egg_ability >> 30) & 1;
+
+    const u32 pid = out.personality_value;
+    out.shiny = ((out.ot_id >> 16) ^ (out.ot_id & 0xFFFF) ^ (pid >> 16) ^ (pid & 0xFFFF)) < 8;
+    out.nickname = decode_text(raw + 8, 10);
+    out.ot_name = decode_text(raw + 20, 7);
+    return out;
+}
+
+boxed_pkmn gen3_pc_boxes::decode(int slot) const
+{
+    uchar raw[BOX_PKMN_SIZE];
+    if (image == nullptr || slot < 0 || slot >= SLOT_COUNT ||
+        !read(PC_SLOTS_OFFSET + static_cast<usize>(slot) * BOX_PKMN_SIZE, sizeof(raw), raw))
+        return {};
+    return decode_pkmn(raw);
+}
+
+int gen3_pc_boxes::party_size() const
+{
+    if (image == nullptr)
+        return 0;
+    const char *data = image->bytes().constData();
+    return static_cast<int>(
+        std::min<u32>(qFromLittleEndian<u32>(data + team_size_offset), PARTY_SLOT_COUNT));
+}
+
+boxed_pkmn gen3_pc_boxes::decode_party(int slot) const
+{
+    if (slot < 0 || slot >= party_size())
+        return {};
+    uchar raw[BOX_PKMN_SIZE];
+    memcpy(raw,
+           image->bytes().constData() + team_size_offset + sizeof(u32) + slot * PARTY_PKMN_SIZE,
+           sizeof(raw));
+    return decode_pkmn(raw);
+}
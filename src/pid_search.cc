@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "pid_search.h"
+#include "trace.h"
+
+#include <algorithm>
+#include <thread>
+
+// Seeds are tested BATCH at a time, one loop per step over flat arrays, so
+// that the compiler can run each step across SIMD lanes. Only the seeds that
+// pass every lane filter reach the scalar code that builds results.
+static constexpr u32 BATCH = 256;
+static constexpr u32 CHUNK_SIZE = static_cast<u32>((std::uint64_t { 1 } << 32) / PID_SEARCH_CHUNKS);
+static_assert(CHUNK_SIZE % BATCH == 0);
+
+int pid_nature(u32 pid)
+{
+    return static_cast<int>(pid % 25);
+}
+
+bool pid_shiny(u32 pid, u16 tid, u16 sid)
+{
+    return (tid ^ sid ^ (pid >> 16) ^ (pid & 0xFFFF)) < 8;
+}
+
+int pid_gender(u32 pid, u8 gender_threshold)
+{
+    return (pid & 0xFF) < gender_threshold ? PID_SEARCH_FEMALE : PID_SEARCH_MALE;
+}
+
+// The IV words drawn after the PID call that left the LCG at `state`.
+static void draw_ivs(u32 state, bool skip_before, bool skip_between, u32 &iv1, u32 &iv2)
+{
+    u32 s = gen3_lcg_next(state);
+    s = skip_before ? gen3_lcg_next(s) : s;
+    iv1 = s >> 16;
+    s = gen3_lcg_next(s);
+    s = skip_between ? gen3_lcg_next(s) : s;
+    iv2 = s >> 16;
+}
+
+static u32 iv_of(u32 iv1, u32 iv2, usize stat)
+{
+    return ((stat < 3 ? iv1 : iv2) >> (5 * (stat % 3))) & 31;
+}
+
+std::array<u8, 6> gen3_method_ivs(rng_method method, u32 state)
+{
+    std::array<u8, 6> ivs {};
+    if (method == rng_method::Any_Pid)
+        return ivs;
+
+    u32 iv1 = 0;
+    u32 iv2 = 0;
+    draw_ivs(state, method == rng_method::Method_2, method == rng_method::Method_4, iv1, iv2);
+    for (usize stat = 0; stat < 6; ++stat)
+        ivs[stat] = static_cast<u8>(iv_of(iv1, iv2, stat));
+    return ivs;
+}
+
+static void search_chunk(const pid_search_criteria &c, u32 first,
+                         std::vector<pid_search_result> &out)
+{
+    alignas(64) u32 pid[BATCH];
+    alignas(64) u32 state[BATCH];
+    alignas(64) u32 iv1[BATCH];
+    alignas(64) u32 iv2[BATCH];
+    alignas(64) u32 keep[BATCH];
+
+    const bool any_pid = c.method == rng_method::Any_Pid;
+    const bool skip_before = c.method == rng_method::Method_2;
+    const bool skip_between = c.method == rng_method::Method_4;
+    bool filter_ivs = false;
+    for (usize stat = 0; stat < 6; ++stat)
+        filter_ivs |= c.iv_min[stat] > 0 || c.iv_max[stat] < 31;
+    filter_ivs &= !any_pid;
+
+    const u32 tsv = c.tid ^ c.sid;
+    const u32 ability = static_cast<u32>(c.ability);
+    const u32 nature = static_cast<u32>(c.nature);
+    const u32 female = c.gender == PID_SEARCH_FEMALE;
+
+    for (u32 offset = 0; offset < CHUNK_SIZE; offset += BATCH) {
+        const u32 base = first + offset;
+        if (any_pid) {
+            for (u32 k = 0; k < BATCH; ++k)
+                pid[k] = base + k;
+        } else {
+            for (u32 k = 0; k < BATCH; ++k) {
+                const u32 low = gen3_lcg_next(base + k);
+                state[k] = gen3_lcg_next(low);
+                pid[k] = (state[k] & 0xFFFF0000u) | (low >> 16);
+            }
+        }
+
+        // Cheapest and most selective filters first; each is its own loop so
+        // that unused ones cost nothing.
+        for (u32 k = 0; k < BATCH; ++k)
+            keep[k] = 1;
+        if (c.shiny)
+            for (u32 k = 0; k < BATCH; ++k)
+                keep[k] &= (tsv ^ (pid[k] >> 16) ^ (pid[k] & 0xFFFF)) < 8;
+        if (c.ability != PID_SEARCH_ANY)
+            for (u32 k = 0; k < BATCH; ++k)
+                keep[k] &= (pid[k] & 1) == ability;
+        if (c.gender != PID_SEARCH_ANY)
+            for (u32 k = 0; k < BATCH; ++k)
+                keep[k] &= ((pid[k] & 0xFF) < c.gender_threshold) == female;
+        if (c.nature != PID_SEARCH_ANY)
+            for (u32 k = 0; k < BATCH; ++k)
+                keep[k] &= pid[k] % 25 == nature;
+        if (filter_ivs) {
+            for (u32 k = 0; k < BATCH; ++k)
+                draw_ivs(state[k], skip_before, skip_between, iv1[k], iv2[k]);
+            for (usize stat = 0; stat < 6; ++stat) {
+                if (c.iv_min[stat] == 0 && c.iv_max[stat] >= 31)
+                    continue;
+                const u32 *words = stat < 3 ? iv1 : iv2;
+                const u32 shift = 5 * (stat % 3);
+                const u32 lo = c.iv_min[stat];
+                const u32 hi = c.iv_max[stat];
+                for (u32 k = 0; k < BATCH; ++k) {
+                    const u32 iv = (words[k] >> shift) & 31;
+                    keep[k] &= iv >= lo && iv <= hi;
+                }
+            }
+        }
+
+        for (u32 k = 0; k < BATCH; ++k) {
+            if (!keep[k])
+                continue;
+            out.push_back({ base + k, pid[k],
+                            any_pid ? c.iv_max : gen3_method_ivs(c.method, state[k]) });
+        }
+    }
+}
+
+void run_pid_search(const pid_search_criteria &criteria, unsigned jobs,
+                    pid_search_progress &progress,
+                    const std::function<void(std::vector<pid_search_result>)> &on_results)
+{
+    PKEDIT_TRACE_SCOPE("run_pid_search");
+    if (jobs == 0)
+        jobs = std::max(1u, std::thread::hardware_concurrency());
+
+    std::atomic<u32> next { 0 };
+    auto worker = [&] {
+        std::vector<pid_search_result> found;
+        for (u32 chunk = next.fetch_add(1, std::memory_order_relaxed); chunk < PID_SEARCH_CHUNKS;
+             chunk = next.fetch_add(1, std::memory_order_relaxed)) {
+            if (progress.cancel.load(std::memory_order_relaxed))
+                return;
+
+            found.clear();
+            search_chunk(criteria, chunk * CHUNK_SIZE, found);
+            progress.chunks_done.fetch_add(1, std::memory_order_relaxed);
+            if (found.empty())
+                continue;
+
+            // Trim to what is left of max_results.
+            const usize before = progress.found.fetch_add(found.size());
+            if (before >= criteria.max_results)
+                return;
+            if (before + found.size() >= criteria.max_results) {
+                found.resize(criteria.max_results - before);
+                progress.cancel = true;
+            }
+            on_results(found);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(jobs);
+    for (unsigned i = 0; i < jobs; ++i)
+        pool.emplace_back(worker);
+    for (auto &t : pool)
+        t.join();
+}
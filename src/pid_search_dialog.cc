@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "pid_search_dialog.h"
+
+#include <QCheckBox>
+#include <QClipboard>
+#include <QComboBox>
+#include <QFormLayout>
+#include <QFutureWatcher>
+#include <QGuiApplication>
+#include <QGridLayout>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QTableView>
+#include <QTimer>
+#include <QVBoxLayout>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+pid_results_model::pid_results_model(QStringList n, QObject *parent)
+    : QAbstractTableModel(parent), natures(std::move(n))
+{
+}
+
+void pid_results_model::reset(const pid_search_criteria &c)
+{
+    beginResetModel();
+    results.clear();
+    criteria = c;
+    endResetModel();
+}
+
+void pid_results_model::append(const std::vector<pid_search_result> &batch)
+{
+    if (batch.empty())
+        return;
+
+    const int first = rowCount();
+    beginInsertRows({}, first, first + static_cast<int>(batch.size()) - 1);
+    results.insert(results.end(), batch.begin(), batch.end());
+    endInsertRows();
+}
+
+int pid_results_model::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(results.size());
+}
+
+int pid_results_model::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : PID_TABLE_COLUMN_COUNT;
+}
+
+static QString hex32(u32 value)
+{
+    return QString::number(value, 16).rightJustified(8, '0').toUpper();
+}
+
+QVariant pid_results_model::data(const QModelIndex &i, int role) const
+{
+    if (role != Qt::DisplayRole || !i.isValid() || i.row() >= rowCount())
+        return {};
+
+    const pid_search_result &result = results[i.row()];
+    switch (i.column()) {
+        default:
+            return {};
+        case PID_TABLE_SEED_COL:
+            return criteria.method == rng_method::Any_Pid ? QStringLiteral("-")
+                                                          : hex32(result.seed);
+        case PID_TABLE_PID_COL:
+            return hex32(result.pid);
+        case PID_TABLE_NATURE_COL:
+            return natures.value(pid_nature(result.pid));
+        case PID_TABLE_GENDER_COL:
+            return pid_gender(result.pid, criteria.gender_threshold) == PID_SEARCH_FEMALE
+                       ? QStringLiteral("Female")
+                       : QStringLiteral("Male");
+        case PID_TABLE_ABILITY_COL:
+            return static_cast<uint>(result.pid & 1) + 1;
+        case PID_TABLE_SHINY_COL:
+            return pid_shiny(result.pid, criteria.tid, criteria.sid) ? QStringLiteral("Yes")
+                                                                     : QStringLiteral("No");
+        case PID_TABLE_IVS_COL:
+            if (criteria.method == rng_method::Any_Pid)
+                return QStringLiteral("Any");
+            return QStringLiteral("%1/%2/%3/%4/%5/%6")
+                .arg(result.ivs[0])
+                .arg(result.ivs[1])
+                .arg(result.ivs[2])
+                .arg(result.ivs[3])
+                .arg(result.ivs[4])
+                .arg(result.ivs[5]);
+    }
+}
+
+QVariant pid_results_model::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (role != Qt::DisplayRole || orientation != Qt::Horizontal)
+        return QAbstractTableModel::headerData(section, orientation, role);
+
+    switch (section) {
+        default:
+            return {};
+        case PID_TABLE_SEED_COL:
+            return QStringLiteral("Seed");
+        case PID_TABLE_PID_COL:
+            return QStringLiteral("PID");
+        case PID_TABLE_NATURE_COL:
+            return QStringLiteral("Nature");
+        case PID_TABLE_GENDER_COL:
+            return QStringLiteral("Gender");
+        case PID_TABLE_ABILITY_COL:
+            return QStringLiteral("Ability");
+        case PID_TABLE_SHINY_COL:
+            return QStringLiteral("Shiny");
+        case PID_TABLE_IVS_COL:
+            return QStringLiteral("IVs");
+    }
+}
+
+pid_search_dialog::pid_search_dialog(const QStringList &natures, QWidget *parent)
+    : QDialog(parent)
+{
+    setWindowTitle("Find PID/IVs");
+    resize(800, 600);
+
+    method_combo = new QComboBox(this);
+    method_combo->addItems({ "Any PID", "Method 1", "Method 2", "Method 4" });
+    method_combo->setCurrentIndex(static_cast<int>(rng_method::Method_1));
+    tid_spin = new QSpinBox(this);
+    tid_spin->setRange(0, 0xFFFF);
+    sid_spin = new QSpinBox(this);
+    sid_spin->setRange(0, 0xFFFF);
+    shiny_check = new QCheckBox("Shiny", this);
+    nature_combo = new QComboBox(this);
+    nature_combo->addItem("Any");
+    nature_combo->addItems(natures);
+    gender_combo = new QComboBox(this);
+    gender_combo->addItems({ "Any", "Male", "Female" });
+    ratio_combo = new QComboBox(this);
+    ratio_combo->addItem("1/8 female", 31);
+    ratio_combo->addItem("1/4 female", 63);
+    ratio_combo->addItem("1/2 female", 127);
+    ratio_combo->addItem("3/4 female", 191);
+    ratio_combo->setCurrentIndex(2);
+    ability_combo = new QComboBox(this);
+    ability_combo->addItems({ "Any", "First", "Second" });
+
+    auto *ids_row = new QHBoxLayout;
+    ids_row->addWidget(tid_spin);
+    ids_row->addWidget(new QLabel("SID:", this));
+    ids_row->addWidget(sid_spin);
+    auto *gender_row = new QHBoxLayout;
+    gender_row->addWidget(gender_combo);
+    gender_row->addWidget(ratio_combo);
+    auto *form = new QFormLayout;
+    form->addRow("Method:", method_combo);
+    form->addRow("TID:", ids_row);
+    form->addRow("", shiny_check);
+    form->addRow("Nature:", nature_combo);
+    form->addRow("Gender:", gender_row);
+    form->addRow("Ability:", ability_combo);
+
+    static constexpr const char *stat_names[6] { "HP", "Atk", "Def", "Spe", "SpA", "SpD" };
+    auto *iv_grid = new QGridLayout;
+    iv_grid->addWidget(new QLabel("Min IV", this), 1, 0);
+    iv_grid->addWidget(new QLabel("Max IV", this), 2, 0);
+    for (int stat = 0; stat < 6; ++stat) {
+        iv_grid->addWidget(new QLabel(stat_names[stat], this), 0, stat + 1);
+        iv_min_spins[stat] = new QSpinBox(this);
+        iv_min_spins[stat]->setRange(0, 31);
+        iv_max_spins[stat] = new QSpinBox(this);
+        iv_max_spins[stat]->setRange(0, 31);
+        iv_max_spins[stat]->setValue(31);
+        iv_grid->addWidget(iv_min_spins[stat], 1, stat + 1);
+        iv_grid->addWidget(iv_max_spins[stat], 2, stat + 1);
+    }
+    connect(method_combo, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
+            [this](int index) {
+                // IVs are free for a bare PID.
+                for (int stat = 0; stat < 6; ++stat) {
+                    iv_min_spins[stat]->setEnabled(index != 0);
+                    iv_max_spins[stat]->setEnabled(index != 0);
+                }
+            });
+
+    search_button = new QPushButton("Search", this);
+    progress_bar = new QProgressBar(this);
+    progress_bar->setRange(0, PID_SEARCH_CHUNKS);
+    progress_bar->setValue(0);
+    auto *search_row = new QHBoxLayout;
+    search_row->addWidget(progress_bar, 1);
+    search_row->addWidget(search_button);
+
+    results = new pid_results_model(natures, this);
+    results_view = new QTableView(this);
+    results_view->setModel(results);
+    results_view->setSelectionBehavior(QAbstractItemView::SelectRows);
+    results_view->setSelectionMode(QAbstractItemView::SingleSelection);
+    results_view->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    results_view->setShowGrid(false);
+    results_view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    status_label = new QLabel("Double-click a result to copy its PID and IVs", this);
+
+    auto *layout = new QVBoxLayout(this);
+    layout->addLayout(form);
+    layout->addLayout(iv_grid);
+    layout->addLayout(search_row);
+    layout->addWidget(results_view);
+    layout->addWidget(status_label);
+
+    progress_timer = new QTimer(this);
+    progress_timer->setInterval(100);
+    connect(progress_timer, &QTimer::timeout, this, [this] {
+        progress_bar->setValue(static_cast<int>(progress->chunks_done.load()));
+    });
+    connect(search_button, &QPushButton::clicked, this, [this] {
+        if (search.isRunning())
+            stop_search();
+        else
+            start_search();
+    });
+    connect(results_view, &QTableView::doubleClicked, this,
+            [this](const QModelIndex &i) { copy_result(i.row()); });
+}
+
+pid_search_dialog::~pid_search_dialog()
+{
+    // The workers post their matches to this dialog.
+    if (progress != nullptr)
+        progress->cancel = true;
+    search.waitForFinished();
+}
+
+void pid_search_dialog::set_trainer_ids(u16 tid, u16 sid)
+{
+    tid_spin->setValue(tid);
+    sid_spin->setValue(sid);
+}
+
+pid_search_criteria pid_search_dialog::criteria_from_ui() const
+{
+    pid_search_criteria c {};
+    c.method = static_cast<rng_method>(method_combo->currentIndex());
+    c.tid = static_cast<u16>(tid_spin->value());
+    c.sid = static_cast<u16>(sid_spin->value());
+    c.shiny = shiny_check->isChecked();
+    c.nature = nature_combo->currentIndex() - 1;
+    c.gender = gender_combo->currentIndex() - 1;
+    c.gender_threshold = static_cast<u8>(ratio_combo->currentData().toUInt());
+    c.ability = ability_combo->currentIndex() - 1;
+    for (usize stat = 0; stat < 6; ++stat) {
+        c.iv_min[stat] = static_cast<u8>(iv_min_spins[stat]->value());
+        c.iv_max[stat] = static_cast<u8>(std::max(iv_min_spins[stat]->value(),
+                                                  iv_max_spins[stat]->value()));
+    }
+    return c;
+}
+
+void pid_search_dialog::start_search()
+{
+    criteria = criteria_from_ui();
+    results->reset(criteria);
+    progress = std::make_unique<pid_search_progress>();
+    progress_bar->setValue(0);
+    search_button->setText("Stop");
+    status_label->setText("Searching...");
+    clock.start();
+    progress_timer->start();
+
+    // Matches are handed over in the order the workers find them. The
+    // dialog outlives the search: its destructor waits for the workers.
+    auto *watcher = new QFutureWatcher<void>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher] {
+        watcher->deleteLater();
+        finish_search();
+    });
+    search = QtConcurrent::run([this, c = criteria, p = progress.get()] {
+        run_pid_search(c, 0, *p, [this](std::vector<pid_search_result> found) {
+            QMetaObject::invokeMethod(
+                this, [this, found = std::move(found)] { results->append(found); },
+                Qt::QueuedConnection);
+        });
+    });
+    watcher->setFuture(search);
+}
+
+void pid_search_dialog::copy_result(int row)
+{
+    // libpkedit has no PID setter: its gender, nature, shiny and ability
+    // setters each pick a PID of their own, so a result can't be written to
+    // a Pokemon exactly. It is copied for use elsewhere instead.
+    const QString text { results->data(results->index(row, PID_TABLE_PID_COL)).toString() +
+                         ' ' + results->data(results->index(row, PID_TABLE_IVS_COL)).toString() };
+    QGuiApplication::clipboard()->setText(text);
+    status_label->setText("Copied " + text);
+}
+
+void pid_search_dialog::stop_search()
+{
+    if (progress != nullptr)
+        progress->cancel = true;
+}
+
+void pid_search_dialog::finish_search()
+{
+    progress_timer->stop();
+    progress_bar->setValue(static_cast<int>(progress->chunks_done.load()));
+    search_button->setText("Search");
+    const bool complete = progress->chunks_done.load() == PID_SEARCH_CHUNKS;
+    status_label->setText(QString("%1 match(es) %2 in %3 s; double-click one to copy it")
+                              .arg(results->rowCount())
+                              .arg(complete ? "found" : "found before stopping")
+                              .arg(clock.elapsed() / 1000.0, 0, 'f', 2));
+}
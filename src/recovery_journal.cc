@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "recovery_journal.h"
+#include "mapped_file.h"
+
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+
+// Header layout: magic, bytes of records, size and hash of the save file.
+static constexpr char JOURNAL_MAGIC[8] = { 'P', 'K', 'E', 'J', 'R', 'N', 'L', '1' };
+static constexpr qint64 HEADER_SIZE = 32;
+static constexpr qint64 USED_OFFSET = 8;
+static constexpr qint64 IMAGE_SIZE_OFFSET = 12;
+static constexpr qint64 IMAGE_HASH_OFFSET = 16;
+// type, category, field, target, value, text length.
+static constexpr qint64 RECORD_HEADER_SIZE = 1 + 1 + 2 + 4 + 4 + 2;
+static constexpr qint64 INITIAL_SIZE = 4 * 1024;
+static constexpr qsizetype MAX_TEXT_SIZE = 0xffff;
+
+// FNV-1a; stable across runs and platforms, unlike qHash().
+static quint64 hash_image(const QByteArray &image)
+{
+    quint64 hash = 0xcbf29ce484222325ull;
+    for (char c : image) {
+        hash ^= static_cast<uchar>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static bool header_matches(const uchar *data, qint64 size, quint32 image_size,
+                           quint64 image_hash)
+{
+    return size >= HEADER_SIZE && memcmp(data, JOURNAL_MAGIC, sizeof JOURNAL_MAGIC) == 0 &&
+           qFromLittleEndian<quint32>(data + IMAGE_SIZE_OFFSET) == image_size &&
+           qFromLittleEndian<quint64>(data + IMAGE_HASH_OFFSET) == image_hash;
+}
+
+// Length of the longest prefix of `text` of at most `max` bytes that doesn't
+// end inside a UTF-8 sequence.
+static qsizetype utf8_prefix_size(const QByteArray &text, qsizetype max) noexcept
+{
+    if (text.size() <= max)
+        return text.size();
+    qsizetype size = max;
+    while (size > 0 && (static_cast<uchar>(text[size]) & 0xc0) == 0x80)
+        --size;
+    return size;
+}
+
+recovery_journal::~recovery_journal() noexcept
+{
+    close();
+}
+
+QString recovery_journal::path_for(const std::string &save_path)
+{
+    return QString::fromStdString(save_path) + ".pkedit-journal";
+}
+
+std::vector<recovery_record> recovery_journal::read(const std::string &save_path,
+                                                    const QByteArray &image)
+{
+    std::vector<recovery_record> records;
+    if (!QFile::exists(path_for(save_path)))
+        return records;
+
+    std::shared_ptr<const mapped_file> mapped;
+    try {
+        mapped = std::make_shared<const mapped_file>(path_for(save_path));
+    } catch (const std::exception &) {
+        return records;
+    }
+
+    const QByteArray &journal { mapped->bytes() };
+    const auto *data = reinterpret_cast<const uchar *>(journal.constData());
+    if (!header_matches(data, journal.size(), static_cast<quint32>(image.size()),
+                        hash_image(image)))
+        return records;
+
+    const qint64 end =
+        std::min<qint64>(HEADER_SIZE + qFromLittleEndian<quint32>(data + USED_OFFSET),
+                         journal.size());
+    for (qint64 off = HEADER_SIZE; off + RECORD_HEADER_SIZE <= end;) {
+        const uchar *p = data + off;
+        recovery_record record {};
+        record.type = static_cast<recovery_record::op>(p[0]);
+        record.category = p[1];
+        record.field = qFromLittleEndian<quint16>(p + 2);
+        record.target = qFromLittleEndian<qint32>(p + 4);
+        record.value = qFromLittleEndian<qint32>(p + 8);
+        const quint16 text_size = qFromLittleEndian<quint16>(p + 12);
+        if (record.type > recovery_record::Pid_Traits ||
+            off + RECORD_HEADER_SIZE + text_size > end)
+            break;
+        record.text = QString::fromUtf8(reinterpret_cast<const char *>(p + RECORD_HEADER_SIZE),
+                                        text_size);
+        records.push_back(std::move(record));
+        off += RECORD_HEADER_SIZE + text_size;
+    }
+    return records;
+}
+
+bool recovery_journal::remap(qint64 size)
+{
+    if (map != nullptr) {
+        file.unmap(map);
+        map = nullptr;
+    }
+    if (file.size() < size && !file.resize(size))
+        return false;
+    map = file.map(0, size);
+    mapped_size = map != nullptr ? size : 0;
+    return map != nullptr;
+}
+
+bool recovery_journal::open(const std::string &save_path, const QByteArray &image,
+                            bool keep_records)
+{
+    close();
+    file.setFileName(path_for(save_path));
+    image_size = static_cast<quint32>(image.size());
+    image_hash = hash_image(image);
+    journaling = true;
+    if (!file.exists())
+        return true;
+
+    if (keep_records && file.open(QIODevice::ReadWrite)) {
+        const qint64 existing = file.size();
+        if (remap(existing) && header_matches(map, existing, image_size, image_hash)) {
+            used = std::min<quint32>(qFromLittleEndian<quint32>(map + USED_OFFSET),
+                                     mapped_size - HEADER_SIZE);
+            return true;
+        }
+        if (map != nullptr)
+            file.unmap(map);
+        map = nullptr;
+        mapped_size = 0;
+        file.close();
+    }
+
+    // Left by an earlier session and either declined or made against other
+    // contents; a new one is created by the next edit.
+    journaling = file.remove();
+    return journaling;
+}
+
+bool recovery_journal::create() noexcept
+{
+    if (!file.open(QIODevice::ReadWrite | QIODevice::Truncate))
+        return false;
+    if (!remap(INITIAL_SIZE)) {
+        file.close();
+        return false;
+    }
+
+    used = 0;
+    memset(map, 0, HEADER_SIZE);
+    memcpy(map, JOURNAL_MAGIC, sizeof JOURNAL_MAGIC);
+    qToLittleEndian<quint32>(0, map + USED_OFFSET);
+    qToLittleEndian<quint32>(image_size, map + IMAGE_SIZE_OFFSET);
+    qToLittleEndian<quint64>(image_hash, map + IMAGE_HASH_OFFSET);
+    return true;
+}
+
+void recovery_journal::append(const recovery_record &record) noexcept
+{
+    if (!journaling)
+        return;
+
+    QByteArray text;
+    try {
+        text = record.text.toUtf8();
+    } catch (const std::exception &) {
+        close();
+        return;
+    }
+    const qsizetype text_size = utf8_prefix_size(text, MAX_TEXT_SIZE);
+    const qint64 size = RECORD_HEADER_SIZE + text_size;
+    if ((map == nullptr && !create()) ||
+        (HEADER_SIZE + used + size > mapped_size &&
+         !remap(std::max(mapped_size * 2, HEADER_SIZE + used + size)))) {
+        close();
+        return;
+    }
+
+    uchar *p = map + HEADER_SIZE + used;
+    p[0] = record.type;
+    p[1] = record.category;
+    qToLittleEndian<quint16>(record.field, p + 2);
+    qToLittleEndian<qint32>(record.target, p + 4);
+    qToLittleEndian<qint32>(record.value, p + 8);
+    qToLittleEndian<quint16>(static_cast<quint16>(text_size), p + 12);
+    memcpy(p + RECORD_HEADER_SIZE, text.constData(), text_size);
+
+    // Publish the record only once it is complete.
+    used += size;
+    qToLittleEndian<quint32>(used, map + USED_OFFSET);
+}
+
+void recovery_journal::close() noexcept
+{
+    journaling = false;
+    if (map != nullptr) {
+        file.unmap(map);
+        map = nullptr;
+    }
+    mapped_size = 0;
+    if (!file.isOpen())
+        return;
+
+    file.close();
+    if (used == 0)
+        file.remove();
+    used = 0;
+}
+
+void recovery_journal::remove() noexcept
+{
+    used = 0;
+    close();
+}
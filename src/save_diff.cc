@@ -0,0 +1,421 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "save_diff.h"
+#include "batch.h"
+#include "pc_boxes.h"
+#include "save_index.h"
+#include "trace.h"
+#include "trainer.h"
+
+#include <QString>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <set>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace fs = std::filesystem;
+
+// Index of the first byte at or after `i` where `a` and `b` are equal
+// (`equal` true) or differ (`equal` false), or `size` if there is none.
+static qsizetype scan(const char *a, const char *b, qsizetype i, qsizetype size, bool equal)
+{
+#if defined(__SSE2__)
+    for (; i + 16 <= size; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + i));
+        // One bit per byte, set where the bytes are equal.
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+        if (!equal)
+            mask = ~mask & 0xFFFF;
+        if (mask != 0)
+            return i + std::countr_zero(mask);
+    }
+#else
+    for (; i + 8 <= size; i += 8) {
+        std::uint64_t x, y;
+        memcpy(&x, a + i, sizeof(x));
+        memcpy(&y, b + i, sizeof(y));
+        if ((x == y) != equal)
+            break;
+    }
+#endif
+    while (i < size && (a[i] == b[i]) != equal)
+        ++i;
+    return i;
+}
+
+std::vector<byte_range> diff_bytes(const QByteArray &a, const QByteArray &b)
+{
+    PKEDIT_TRACE_SCOPE("diff_bytes");
+    std::vector<byte_range> ranges;
+    const qsizetype common = std::min(a.size(), b.size());
+    for (qsizetype i = scan(a.constData(), b.constData(), 0, common, false); i < common;) {
+        const qsizetype end = scan(a.constData(), b.constData(), i, common, true);
+        ranges.push_back({ i, end });
+        i = scan(a.constData(), b.constData(), end, common, false);
+    }
+    if (a.size() != b.size())
+        ranges.push_back({ common, std::max(a.size(), b.size()) });
+    return ranges;
+}
+
+static u8 section_area(int section)
+{
+    if (section == 0)
+        return DIFF_TRAINER;
+    if (section == 1)
+        return DIFF_PARTY | DIFF_ITEMS;
+    if (section >= 5)
+        return DIFF_BOXES;
+    return DIFF_OTHER;
+}
+
+u8 diff_areas(const QByteArray &a, const QByteArray &b, const std::vector<byte_range> &ranges)
+{
+    if (ranges.empty())
+        return 0;
+    if (gen3_pc_boxes::section_at(a, 0) < 0 || gen3_pc_boxes::section_at(b, 0) < 0)
+        return DIFF_ALL;
+
+    // Sections hold 3968 bytes of data followed by a footer, in 4 KiB sectors.
+    // Sectors rotate on every save, so the same offset can hold a different
+    // section in each image, and both are touched.
+    constexpr qsizetype sector_size = 0x1000;
+    constexpr qsizetype data_size = 3968;
+    u8 areas = 0;
+    for (const byte_range &range : ranges) {
+        for (qsizetype i = range.begin; i < range.end;) {
+            const qsizetype sector_begin = i / sector_size * sector_size;
+            const qsizetype next = std::min(range.end, i - sector_begin < data_size
+                                                           ? sector_begin + data_size
+                                                           : sector_begin + sector_size);
+            areas |= section_area(gen3_pc_boxes::section_at(a, i));
+            areas |= section_area(gen3_pc_boxes::section_at(b, i));
+            i = next;
+        }
+    }
+    return areas;
+}
+
+static void compare(std::vector<field_change> &out, const std::string &where, const char *field,
+                    std::string before, std::string after)
+{
+    if (before != after)
+        out.push_back({ where, field, std::move(before), std::move(after) });
+}
+
+static std::string stat_text(const auto &stats)
+{
+    std::string out;
+    for (const auto stat : stats)
+        out += (out.empty() ? "" : "/") + std::to_string(stat);
+    return out;
+}
+
+static void compare_indexed(std::vector<field_change> &out, const std::string &where,
+                            const indexed_pkmn &a, const indexed_pkmn &b)
+{
+    compare(out, where, "Species", std::to_string(a.species), std::to_string(b.species));
+    compare(out, where, "PID", std::format("0x{:08X}", a.personality_value),
+            std::format("0x{:08X}", b.personality_value));
+    compare(out, where, "OT ID", std::to_string(a.ot_public_id), std::to_string(b.ot_public_id));
+    compare(out, where, "OT SID", std::to_string(a.ot_secret_id), std::to_string(b.ot_secret_id));
+    compare(out, where, "IVs", stat_text(a.ivs), stat_text(b.ivs));
+    compare(out, where, "EVs", stat_text(a.evs), stat_text(b.evs));
+    compare(out, where, "Shiny", a.shiny ? "Yes" : "No", b.shiny ? "Yes" : "No");
+    compare(out, where, "Nature", std::to_string(a.nature), std::to_string(b.nature));
+    compare(out, where, "Met location", std::to_string(a.location), std::to_string(b.location));
+}
+
+static std::string held_item_name(const pokemon *pkmn)
+{
+    if (!pkmn->compat_has_held_item() || pkmn->held_item() == nullptr || !pkmn->has_item())
+        return "(none)";
+    return pkmn->held_item()->name();
+}
+
+static void compare_trainer(std::vector<field_change> &out, const pkmn_save &a,
+                            const pkmn_save &b)
+{
+    const std::string where { "Trainer" };
+    compare(out, where, "Name", QString::fromStdWString(a.trainer->name()).toStdString(),
+            QString::fromStdWString(b.trainer->name()).toStdString());
+    compare(out, where, "Gender", a.trainer->is_female() ? "Female" : "Male",
+            b.trainer->is_female() ? "Female" : "Male");
+    compare(out, where, "Public ID", std::to_string(a.trainer->public_id()),
+            std::to_string(b.trainer->public_id()));
+    compare(out, where, "Secret ID", std::to_string(a.trainer->secret_id()),
+            std::to_string(b.trainer->secret_id()));
+    compare(out, where, "Money", std::to_string(a.trainer->money()),
+            std::to_string(b.trainer->money()));
+    compare(out, where, "Coins", std::to_string(a.trainer->coins()),
+            std::to_string(b.trainer->coins()));
+
+    const trainer_time_played ta { a.trainer->time_played() };
+    const trainer_time_played tb { b.trainer->time_played() };
+    compare(out, where, "Time played",
+            std::format("{}:{:02}:{:02}", ta.hours, ta.minutes, ta.seconds),
+            std::format("{}:{:02}:{:02}", tb.hours, tb.minutes, tb.seconds));
+}
+
+static void compare_party(std::vector<field_change> &out, const pkmn_save &a, const pkmn_save &b)
+{
+    const auto &team_a = a.trainer->pkmn_team();
+    const auto &team_b = b.trainer->pkmn_team();
+    for (usize i = 0; i < std::max(team_a.size(), team_b.size()); ++i) {
+        const std::string where { save_index::describe_slot(static_cast<u16>(i)) };
+        if (i >= team_a.size() || i >= team_b.size()) {
+            compare(out, where, "Pokemon", i < team_a.size() ? "Present" : "(empty)",
+                    i < team_b.size() ? "Present" : "(empty)");
+            continue;
+        }
+
+        const pokemon *pa = team_a[i].get();
+        const pokemon *pb = team_b[i].get();
+        compare(out, where, "Nickname", QString::fromStdWString(pa->nickname()).toStdString(),
+                QString::fromStdWString(pb->nickname()).toStdString());
+        compare(out, where, "Level", std::to_string(pa->level()), std::to_string(pb->level()));
+        compare(out, where, "Exp", std::to_string(pa->exp()), std::to_string(pb->exp()));
+        compare(out, where, "Friendship", std::to_string(pa->friendship()),
+                std::to_string(pb->friendship()));
+        compare(out, where, "Held item", held_item_name(pa), held_item_name(pb));
+        compare(out, where, "Moves",
+                std::format("{}/{}/{}/{}", pa->move1(), pa->move2(), pa->move3(), pa->move4()),
+                std::format("{}/{}/{}/{}", pb->move1(), pb->move2(), pb->move3(), pb->move4()));
+        compare_indexed(out, where, index_party_pkmn(pa, static_cast<u16>(i)),
+                        index_party_pkmn(pb, static_cast<u16>(i)));
+    }
+}
+
+static const std::vector<std::shared_ptr<item>> &pocket(const pkmn_save &save,
+                                                         item_category category)
+{
+    switch (category) {
+        default:
+            throw std::runtime_error("invalid item category");
+        case item_category::Pocket:
+            return save.trainer->get_pocket_items();
+        case item_category::Pokeball:
+            return save.trainer->get_ball_items();
+        case item_category::Berry:
+            return save.trainer->get_berry_case();
+        case item_category::Tm:
+            return save.trainer->get_tm_case();
+        case item_category::Key_Item:
+            return save.trainer->get_key_items();
+        case item_category::Pc:
+            return save.trainer->get_pc_items();
+    }
+}
+
+static void compare_items(std::vector<field_change> &out, const pkmn_save &a, const pkmn_save &b)
+{
+    static constexpr std::pair<item_category, const char *> pockets[] {
+        { item_category::Pocket, "Items" },  { item_category::Pokeball, "Balls" },
+        { item_category::Berry, "Berries" }, { item_category::Tm, "TMs" },
+        { item_category::Key_Item, "Key Items" }, { item_category::Pc, "PC Items" },
+    };
+
+    auto describe = [](const auto &items, usize row) -> std::string {
+        if (row >= items.size())
+            return "(empty)";
+        return std::string { items[row]->name() } + " x" + std::to_string(items[row]->count());
+    };
+
+    for (const auto &[category, name] : pockets) {
+        try {
+            const auto &items_a = pocket(a, category);
+            const auto &items_b = pocket(b, category);
+            for (usize row = 0; row < std::max(items_a.size(), items_b.size()); ++row)
+                compare(out, name, ("Row " + std::to_string(row + 1)).c_str(),
+                        describe(items_a, row), describe(items_b, row));
+        } catch (const std::exception &) {
+            // The game has no such pocket.
+        }
+    }
+}
+
+static void compare_boxes(std::vector<field_change> &out, const std::vector<byte_range> &ranges,
+                          const std::shared_ptr<const mapped_file> &image_a,
+                          const std::shared_ptr<const mapped_file> &image_b)
+{
+    gen3_pc_boxes boxes_a {};
+    gen3_pc_boxes boxes_b {};
+    if (!boxes_a.open(image_a) || !boxes_b.open(image_b))
+        return;
+
+    // Only the slots that the changed bytes fall in, in either save.
+    std::set<int> slots;
+    for (const byte_range &range : ranges) {
+        for (const int slot : boxes_a.slots_in(range.begin, range.end))
+            slots.insert(slot);
+        for (const int slot : boxes_b.slots_in(range.begin, range.end))
+            slots.insert(slot);
+    }
+
+    for (int slot : slots) {
+        const boxed_pkmn a { boxes_a.decode(slot) };
+        const boxed_pkmn b { boxes_b.decode(slot) };
+        const std::string where { save_index::describe_slot(
+            static_cast<u16>(INDEX_PC_SLOT_BASE + slot)) };
+        if (a.empty || b.empty || a.corrupt || b.corrupt) {
+            auto state = [](const boxed_pkmn &p) {
+                return p.empty ? "(empty)" : p.corrupt ? "Bad Egg" : "Present";
+            };
+            compare(out, where, "Pokemon", state(a), state(b));
+            continue;
+        }
+        compare(out, where, "Nickname", a.nickname.toStdString(), b.nickname.toStdString());
+        compare(out, where, "Exp", std::to_string(a.exp), std::to_string(b.exp));
+        compare(out, where, "Held item", std::to_string(a.held_item),
+                std::to_string(b.held_item));
+        compare_indexed(out, where, index_boxed_pkmn(a, slot), index_boxed_pkmn(b, slot));
+    }
+}
+
+save_diff diff_saves(const pkmn_save &a, const std::shared_ptr<const mapped_file> &image_a,
+                     const pkmn_save &b, const std::shared_ptr<const mapped_file> &image_b)
+{
+    PKEDIT_TRACE_SCOPE("diff_saves");
+    save_diff out {};
+    const auto start = std::chrono::steady_clock::now();
+    out.ranges = diff_bytes(image_a->bytes(), image_b->bytes());
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    out.compare_ms = elapsed.count();
+
+    for (const byte_range &range : out.ranges)
+        out.bytes_changed += range.end - range.begin;
+    out.areas = diff_areas(image_a->bytes(), image_b->bytes(), out.ranges);
+
+    if (out.areas & DIFF_TRAINER)
+        compare_trainer(out.changes, a, b);
+    if (out.areas & DIFF_PARTY)
+        compare_party(out.changes, a, b);
+    if (out.areas & DIFF_ITEMS)
+        compare_items(out.changes, a, b);
+    if (out.areas & DIFF_BOXES)
+        compare_boxes(out.changes, out.ranges, image_a, image_b);
+    return out;
+}
+
+std::string describe_areas(u8 areas)
+{
+    static constexpr std::pair<u8, const char *> names[] {
+        { DIFF_TRAINER, "trainer" }, { DIFF_PARTY, "party" }, { DIFF_ITEMS, "items" },
+        { DIFF_BOXES, "boxes" },     { DIFF_OTHER, "other" },
+    };
+
+    std::string out;
+    for (const auto &[area, name] : names) {
+        if ((areas & area) == 0)
+            continue;
+        if (!out.empty())
+            out += ", ";
+        out += name;
+    }
+    return out.empty() ? "none" : out;
+}
+
+bool parse_diff_args(int argc, char *argv[], diff_options &out)
+{
+    bool requested = false;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--diff") == 0) {
+            if (i + 2 >= argc)
+                throw std::runtime_error("--diff expects a save and a save or directory");
+            out.base = argv[i + 1];
+            out.other = argv[i + 2];
+            requested = true;
+            i += 2;
+        } else if (strcmp(argv[i], "--recursive") == 0) {
+            out.recursive = true;
+        }
+    }
+    return requested;
+}
+
+// Ranks every save in a directory by how many bytes differ from `base`,
+// closest first. Only the raw images are compared.
+static int rank_candidates(const diff_options &opt, const std::shared_ptr<const mapped_file> &base)
+{
+    struct candidate {
+        std::string path;
+        qsizetype bytes_changed;
+        usize ranges;
+        u8 areas;
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<candidate> candidates;
+    for (const fs::path &path : collect_save_files(opt.other, opt.recursive)) {
+        try {
+            const std::shared_ptr<const mapped_file> image { mapped_file::open(path.string()) };
+            const std::vector<byte_range> ranges { diff_bytes(base->bytes(), image->bytes()) };
+            qsizetype changed = 0;
+            for (const byte_range &range : ranges)
+                changed += range.end - range.begin;
+            candidates.push_back({ path.string(), changed, ranges.size(),
+                                   diff_areas(base->bytes(), image->bytes(), ranges) });
+        } catch (const std::exception &e) {
+            fprintf(stderr, "diff: %s: %s\n", path.string().c_str(), e.what());
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const candidate &a, const candidate &b) {
+                         return a.bytes_changed < b.bytes_changed;
+                     });
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    for (const candidate &c : candidates)
+        printf("%lld\t%zu\t%s\t%s\n", static_cast<long long>(c.bytes_changed), c.ranges,
+               describe_areas(c.areas).c_str(), c.path.c_str());
+    printf("diff: compared %zu candidate(s) in %.3f ms\n", candidates.size(), elapsed.count());
+    return EXIT_SUCCESS;
+}
+
+int run_diff(const diff_options &opt)
+{
+    pkmn_save a {};
+    pkmn_save b {};
+    try {
+        const std::shared_ptr<const mapped_file> image_a { mapped_file::open(opt.base) };
+        if (fs::is_directory(opt.other))
+            return rank_candidates(opt, image_a);
+
+        const std::shared_ptr<const mapped_file> image_b { mapped_file::open(opt.other) };
+        a = read_pkmn_save_file(opt.base.c_str());
+        b = read_pkmn_save_file(opt.other.c_str());
+        const save_diff diff { diff_saves(a, image_a, b, image_b) };
+
+        printf("diff: %lld byte(s) changed in %zu range(s) (%s), compared in %.3f ms\n",
+               static_cast<long long>(diff.bytes_changed), diff.ranges.size(),
+               describe_areas(diff.areas).c_str(), diff.compare_ms);
+        for (const field_change &change : diff.changes)
+            printf("%s\t%s\t%s -> %s\n", change.where.c_str(), change.field.c_str(),
+                   change.before.c_str(), change.after.c_str());
+    } catch (const std::exception &e) {
+        fprintf(stderr, "diff: %s\n", e.what());
+        delete a.trainer;
+        delete b.trainer;
+        return EXIT_FAILURE;
+    }
+
+    delete a.trainer;
+    delete b.trainer;
+    return EXIT_SUCCESS;
+}
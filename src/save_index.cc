@@ -0,0 +1,637 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "save_index.h"
+#include "batch.h"
+#include "mapped_file.h"
+#include "trace.h"
+#include "trainer.h"
+
+#include <QSaveFile>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+// Version 2 decodes the Gen 3 party from the image; older indexes are rebuilt.
+static constexpr char INDEX_MAGIC[8] = { 'P', 'K', 'E', 'I', 'D', 'X', '0', '2' };
+static constexpr std::array<const char *, 6> STAT_NAMES { "hp", "atk", "def", "spe", "spa", "spd" };
+
+template <typename Self, typename F> void save_index::visit_columns(Self &self, F &&f)
+{
+    f(self.file_col);
+    f(self.slot_col);
+    f(self.species_col);
+    f(self.generation_col);
+    f(self.pid_col);
+    f(self.tid_col);
+    f(self.sid_col);
+    for (auto &column : self.iv_cols)
+        f(column);
+    for (auto &column : self.ev_cols)
+        f(column);
+    f(self.shiny_col);
+    f(self.nature_col);
+    f(self.location_col);
+}
+
+void save_index::append(u32 file, const indexed_pkmn &pkmn)
+{
+    file_col.push_back(file);
+    slot_col.push_back(pkmn.slot);
+    species_col.push_back(pkmn.species);
+    generation_col.push_back(pkmn.generation);
+    pid_col.push_back(pkmn.personality_value);
+    tid_col.push_back(pkmn.ot_public_id);
+    sid_col.push_back(pkmn.ot_secret_id);
+    for (usize i = 0; i < STAT_NAMES.size(); ++i) {
+        iv_cols[i].push_back(pkmn.ivs[i]);
+        ev_cols[i].push_back(pkmn.evs[i]);
+    }
+    shiny_col.push_back(pkmn.shiny);
+    nature_col.push_back(pkmn.nature);
+    location_col.push_back(pkmn.location);
+}
+
+indexed_pkmn save_index::record(u32 row) const
+{
+    indexed_pkmn pkmn {};
+    pkmn.slot = slot_col[row];
+    pkmn.species = species_col[row];
+    pkmn.generation = generation_col[row];
+    pkmn.personality_value = pid_col[row];
+    pkmn.ot_public_id = tid_col[row];
+    pkmn.ot_secret_id = sid_col[row];
+    for (usize i = 0; i < STAT_NAMES.size(); ++i) {
+        pkmn.ivs[i] = iv_cols[i][row];
+        pkmn.evs[i] = ev_cols[i][row];
+    }
+    pkmn.shiny = shiny_col[row] != 0;
+    pkmn.nature = nature_col[row];
+    pkmn.location = location_col[row];
+    return pkmn;
+}
+
+std::string save_index::describe_slot(u16 slot)
+{
+    if (slot < INDEX_PC_SLOT_BASE)
+        return "Party " + std::to_string(slot + 1);
+    const int boxed = slot - INDEX_PC_SLOT_BASE;
+    return "Box " + std::to_string(boxed / gen3_pc_boxes::SLOTS_PER_BOX + 1) + ", slot " +
+           std::to_string(boxed % gen3_pc_boxes::SLOTS_PER_BOX + 1);
+}
+
+// On-disk layout, little-endian: the magic, the file and row counts, one
+// entry per file, then each column as a packed array in visit_columns()
+// order.
+class index_reader {
+    const std::string &data;
+    usize pos { 0 };
+
+  public:
+    explicit index_reader(const std::string &data) : data(data) {}
+
+    void read(void *out, usize size)
+    {
+        if (size > data.size() - pos)
+            throw std::runtime_error("save index is truncated");
+        memcpy(out, data.data() + pos, size);
+        pos += size;
+    }
+    template <typename T> T read()
+    {
+        T value {};
+        read(&value, sizeof(value));
+        return value;
+    }
+};
+
+save_index save_index::load(const fs::path &path)
+{
+    PKEDIT_TRACE_SCOPE("save_index::load");
+    save_index index {};
+    std::ifstream in { path, std::ios::binary };
+    if (!in)
+        return index;
+    const std::string data { std::istreambuf_iterator<char> { in }, {} };
+
+    index_reader reader { data };
+    char magic[sizeof(INDEX_MAGIC)];
+    reader.read(magic, sizeof(magic));
+    if (memcmp(magic, INDEX_MAGIC, sizeof(magic)) != 0)
+        throw std::runtime_error(path.string() + " is not a save index");
+
+    const u32 file_count = reader.read<u32>();
+    const u32 row_count = reader.read<u32>();
+    index.files.resize(file_count);
+    for (file_entry &file : index.files) {
+        file.size = reader.read<std::uint64_t>();
+        file.mtime = reader.read<std::int64_t>();
+        file.hash = reader.read<std::uint64_t>();
+        file.first = reader.read<u32>();
+        file.count = reader.read<u32>();
+        file.path.resize(reader.read<u32>());
+        reader.read(file.path.data(), file.path.size());
+        if (file.first > row_count || file.count > row_count - file.first)
+            throw std::runtime_error(path.string() + " is corrupt");
+    }
+    visit_columns(index, [&reader, row_count](auto &column) {
+        column.resize(row_count);
+        reader.read(column.data(), column.size() * sizeof(column[0]));
+    });
+    for (u32 file : index.file_col)
+        if (file >= file_count)
+            throw std::runtime_error(path.string() + " is corrupt");
+    return index;
+}
+
+void save_index::write(const fs::path &path) const
+{
+    PKEDIT_TRACE_SCOPE("save_index::write");
+    // QSaveFile syncs the new contents to disk before renaming them over
+    // `path`.
+    QSaveFile out { QString::fromStdString(path.string()) };
+    if (!out.open(QIODevice::WriteOnly))
+        throw std::runtime_error("unable to write " + path.string());
+    {
+        bool ok = true;
+        auto put = [&out, &ok](const void *data, usize size) {
+            ok = ok && out.write(static_cast<const char *>(data), static_cast<qint64>(size)) ==
+                           static_cast<qint64>(size);
+        };
+        auto put_value = [&put](auto value) { put(&value, sizeof(value)); };
+
+        put(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+        put_value(static_cast<u32>(files.size()));
+        put_value(static_cast<u32>(size()));
+        for (const file_entry &file : files) {
+            put_value(file.size);
+            put_value(file.mtime);
+            put_value(file.hash);
+            put_value(file.first);
+            put_value(file.count);
+            put_value(static_cast<u32>(file.path.size()));
+            put(file.path.data(), file.path.size());
+        }
+        visit_columns(*this, [&put](const auto &column) {
+            put(column.data(), column.size() * sizeof(column[0]));
+        });
+        if (!ok) {
+            out.cancelWriting();
+            throw std::runtime_error("unable to write " + path.string());
+        }
+    }
+
+    if (!out.commit())
+        throw std::runtime_error("unable to replace " + path.string());
+}
+
+static std::uint64_t fnv1a(const QByteArray &bytes)
+{
+    std::uint64_t hash = 0xcbf29ce484222325;
+    for (char c : bytes) {
+        hash ^= static_cast<uchar>(c);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+indexed_pkmn index_party_pkmn(const pokemon *pkmn, u16 slot)
+{
+    indexed_pkmn out {};
+    out.slot = slot;
+    out.species = static_cast<u16>(pkmn->species());
+    out.generation = static_cast<u8>(pkmn->generation());
+    out.personality_value = pkmn->personality_value();
+    out.ot_public_id = static_cast<u16>(pkmn->ot_public_id());
+    out.ot_secret_id = static_cast<u16>(pkmn->ot_secret_id());
+
+    out.ivs[0] = static_cast<u8>(pkmn->hp_iv());
+    out.ivs[1] = static_cast<u8>(pkmn->attack_iv());
+    out.ivs[2] = static_cast<u8>(pkmn->defense_iv());
+    out.ivs[3] = static_cast<u8>(pkmn->speed_iv());
+    out.evs[0] = static_cast<u16>(pkmn->hp_ev());
+    out.evs[1] = static_cast<u16>(pkmn->attack_ev());
+    out.evs[2] = static_cast<u16>(pkmn->defense_ev());
+    out.evs[3] = static_cast<u16>(pkmn->speed_ev());
+    if (!pkmn->compat_has_spc_eviv()) {
+        out.ivs[4] = static_cast<u8>(pkmn->special_atk_iv());
+        out.ivs[5] = static_cast<u8>(pkmn->special_def_iv());
+        out.evs[4] = static_cast<u16>(pkmn->special_atk_ev());
+        out.evs[5] = static_cast<u16>(pkmn->special_def_ev());
+    } else {
+        out.ivs[4] = out.ivs[5] = static_cast<u8>(pkmn->special_dv());
+        out.evs[4] = out.evs[5] = static_cast<u16>(pkmn->special_ev());
+    }
+
+    out.shiny = pkmn->compat_has_shiny() && pkmn->is_shiny();
+    if (pkmn->compat_has_nature())
+        out.nature = static_cast<u8>(pkmn->nature());
+    if (pkmn->compat_has_location_met())
+        out.location = static_cast<u16>(pkmn->met_location());
+    return out;
+}
+
+// A Pokemon decoded from a Gen 3 image, whether boxed or in the party.
+static indexed_pkmn index_decoded_pkmn(const boxed_pkmn &pkmn, u16 slot)
+{
+    indexed_pkmn out {};
+    out.slot = slot;
+    out.species = pkmn.national_dex;
+    out.generation = 3;
+    out.personality_value = pkmn.personality_value;
+    out.ot_public_id = static_cast<u16>(pkmn.ot_id);
+    out.ot_secret_id = static_cast<u16>(pkmn.ot_id >> 16);
+    out.ivs = pkmn.ivs;
+    std::copy(pkmn.evs.begin(), pkmn.evs.end(), out.evs.begin());
+    out.shiny = pkmn.shiny;
+    out.nature = static_cast<u8>(pkmn.personality_value % 25);
+    out.location = pkmn.met_location;
+    return out;
+}
+
+indexed_pkmn index_boxed_pkmn(const boxed_pkmn &pkmn, int slot)
+{
+    return index_decoded_pkmn(pkmn, static_cast<u16>(INDEX_PC_SLOT_BASE + slot));
+}
+
+static std::vector<indexed_pkmn> extract_pkmn(const std::string &path,
+                                              std::shared_ptr<const mapped_file> image)
+{
+    PKEDIT_TRACE_SCOPE("save_index::extract_pkmn");
+    // Even when its Pokemon are read from the image, the save is loaded so
+    // that only saves the editor can open are indexed.
+    pkmn_save save { read_pkmn_save_file(path.c_str()) };
+    std::vector<indexed_pkmn> out;
+
+    // libpkedit only exposes the party, so Gen 3 boxes are read from the
+    // image. The party is too, so that every Gen 3 row has the same species
+    // and met location numbering, whatever the party holds.
+    gen3_pc_boxes boxes {};
+    const bool gen3 = boxes.open(std::move(image));
+    try {
+        const auto &team = save.trainer->pkmn_team();
+        for (usize i = 0; !gen3 && i < team.size(); ++i)
+            out.push_back(index_party_pkmn(team[i].get(), static_cast<u16>(i)));
+    } catch (...) {
+        delete save.trainer;
+        throw;
+    }
+    delete save.trainer;
+
+    if (gen3) {
+        for (int slot = 0; slot < boxes.party_size(); ++slot) {
+            const boxed_pkmn pkmn { boxes.decode_party(slot) };
+            if (!pkmn.empty && !pkmn.corrupt)
+                out.push_back(index_decoded_pkmn(pkmn, static_cast<u16>(slot)));
+        }
+        for (int slot = 0; slot < gen3_pc_boxes::SLOT_COUNT; ++slot) {
+            const boxed_pkmn pkmn { boxes.decode(slot) };
+            if (!pkmn.empty && !pkmn.corrupt)
+                out.push_back(index_boxed_pkmn(pkmn, slot));
+        }
+    }
+    return out;
+}
+
+save_index::update_stats save_index::update(const std::string &directory, bool recursive,
+                                            unsigned jobs)
+{
+    PKEDIT_TRACE_SCOPE("save_index::update");
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<fs::path> paths { collect_save_files(directory, recursive) };
+
+    std::unordered_map<std::string, const file_entry *> indexed;
+    for (const file_entry &file : files)
+        indexed.emplace(file.path, &file);
+
+    struct scanned_file {
+        file_entry entry {};
+        const file_entry *unchanged { nullptr };
+        std::vector<indexed_pkmn> pkmn {};
+        std::string error {};
+    };
+    std::vector<scanned_file> scanned(paths.size());
+
+    auto scan = [&](usize i) {
+        scanned_file &file = scanned[i];
+        file.entry.path = paths[i].string();
+        file.entry.size = fs::file_size(paths[i]);
+        file.entry.mtime = fs::last_write_time(paths[i]).time_since_epoch().count();
+
+        const auto it = indexed.find(file.entry.path);
+        const file_entry *old = it != indexed.end() ? it->second : nullptr;
+        if (old != nullptr && old->size == file.entry.size && old->mtime == file.entry.mtime) {
+            file.unchanged = old;
+            file.entry.hash = old->hash;
+            return;
+        }
+
+        std::shared_ptr<const mapped_file> image { mapped_file::open(file.entry.path) };
+        file.entry.hash = fnv1a(image->bytes());
+        if (old != nullptr && old->hash == file.entry.hash) {
+            file.unchanged = old;
+            return;
+        }
+        file.pkmn = extract_pkmn(file.entry.path, std::move(image));
+    };
+
+    if (jobs == 0)
+        jobs = std::max(1u, std::thread::hardware_concurrency());
+    jobs = std::max(1u, std::min<unsigned>(jobs, paths.size()));
+    std::atomic<usize> next { 0 };
+    auto worker = [&] {
+        for (usize i = next.fetch_add(1, std::memory_order_relaxed); i < paths.size();
+             i = next.fetch_add(1, std::memory_order_relaxed)) {
+            try {
+                scan(i);
+            } catch (const std::exception &e) {
+                scanned[i].error = e.what();
+            }
+        }
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(jobs);
+    for (unsigned i = 0; i < jobs; ++i)
+        pool.emplace_back(worker);
+    for (auto &t : pool)
+        t.join();
+
+    // Rebuild the columns in path order, copying the rows of unchanged saves.
+    update_stats stats {};
+    stats.scanned = paths.size();
+    save_index next_index {};
+    for (scanned_file &file : scanned) {
+        if (!file.error.empty()) {
+            stats.errors.push_back(file.entry.path + ": " + file.error);
+            continue;
+        }
+
+        const u32 id = static_cast<u32>(next_index.files.size());
+        file.entry.first = static_cast<u32>(next_index.size());
+        if (file.unchanged != nullptr) {
+            for (u32 row = 0; row < file.unchanged->count; ++row)
+                next_index.append(id, record(file.unchanged->first + row));
+            ++stats.reused;
+        } else {
+            for (const indexed_pkmn &pkmn : file.pkmn)
+                next_index.append(id, pkmn);
+            ++stats.extracted;
+        }
+        file.entry.count = static_cast<u32>(next_index.size()) - file.entry.first;
+        next_index.files.push_back(std::move(file.entry));
+    }
+    *this = std::move(next_index);
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    stats.seconds = elapsed.count();
+    return stats;
+}
+
+const char *save_index::query_fields()
+{
+    return "species gen pid tid sid hp_iv atk_iv def_iv spe_iv spa_iv spd_iv hp_ev atk_ev "
+           "def_ev spe_ev spa_ev spd_ev nature location slot shiny party boxed";
+}
+
+save_index::column_ref save_index::column_named(const std::string &name) const
+{
+    if (name == "species")
+        return &species_col;
+    if (name == "gen")
+        return &generation_col;
+    if (name == "pid")
+        return &pid_col;
+    if (name == "tid")
+        return &tid_col;
+    if (name == "sid")
+        return &sid_col;
+    if (name == "nature")
+        return &nature_col;
+    if (name == "location")
+        return &location_col;
+    if (name == "slot")
+        return &slot_col;
+    if (name == "shiny")
+        return &shiny_col;
+    for (usize i = 0; i < STAT_NAMES.size(); ++i) {
+        if (name == std::string { STAT_NAMES[i] } + "_iv")
+            return &iv_cols[i];
+        if (name == std::string { STAT_NAMES[i] } + "_ev")
+            return &ev_cols[i];
+    }
+    throw std::runtime_error("unknown field \"" + name + "\"; fields are: " + query_fields());
+}
+
+// Narrows `rows` to those where `column` satisfies `matches`, or, for the
+// first condition, scans the whole column.
+template <typename T, typename Pred>
+static void filter_rows(const std::vector<T> &column, Pred matches, bool first,
+                        std::vector<u32> &rows)
+{
+    if (first) {
+        for (u32 row = 0; row < column.size(); ++row)
+            if (matches(column[row]))
+                rows.push_back(row);
+    } else {
+        std::erase_if(rows, [&](u32 row) { return !matches(column[row]); });
+    }
+}
+
+std::vector<u32> save_index::query(const std::string &query) const
+{
+    PKEDIT_TRACE_SCOPE("save_index::query");
+    struct condition {
+        column_ref column;
+        std::string op;
+        u32 value;
+    };
+
+    std::vector<condition> conditions;
+    usize pos = 0;
+    while (pos < query.size()) {
+        const usize begin = query.find_first_not_of(' ', pos);
+        if (begin == std::string::npos)
+            break;
+        const usize end = std::min(query.find(' ', begin), query.size());
+        const std::string term { query.substr(begin, end - begin) };
+        pos = end;
+
+        if (term == "shiny") {
+            conditions.push_back({ &shiny_col, "=", 1 });
+            continue;
+        }
+        if (term == "party" || term == "boxed") {
+            conditions.push_back({ &slot_col, term == "party" ? "<" : ">=", INDEX_PC_SLOT_BASE });
+            continue;
+        }
+
+        const usize op_begin = term.find_first_of("=!<>");
+        if (op_begin == std::string::npos || op_begin == 0)
+            throw std::runtime_error("expected field<op>value, got \"" + term + "\"");
+        const usize value_begin = term.find_first_not_of("=!<>", op_begin);
+        const std::string op { term.substr(op_begin, value_begin - op_begin) };
+        if (op != "=" && op != "!=" && op != "<" && op != "<=" && op != ">" && op != ">=")
+            throw std::runtime_error("unknown operator \"" + op + "\" in \"" + term + "\"");
+        if (value_begin == std::string::npos)
+            throw std::runtime_error("missing value in \"" + term + "\"");
+
+        // Decimal, or hexadecimal with a 0x prefix (PIDs are printed that
+        // way). stoul() would also take octal and wrap negative numbers.
+        const std::string value { term.substr(value_begin) };
+        const bool hex = value.starts_with("0x") || value.starts_with("0X");
+        const std::string digits { hex ? value.substr(2) : value };
+        u32 n = 0;
+        try {
+            if (digits.empty() || !isxdigit(static_cast<uchar>(digits[0])))
+                throw std::invalid_argument(value);
+            usize parsed = 0;
+            const unsigned long parsed_value = std::stoul(digits, &parsed, hex ? 16 : 10);
+            if (parsed != digits.size() || parsed_value > UINT32_MAX)
+                throw std::invalid_argument(value);
+            n = static_cast<u32>(parsed_value);
+        } catch (const std::exception &) {
+            throw std::runtime_error("invalid value in \"" + term + "\"");
+        }
+        conditions.push_back({ column_named(term.substr(0, op_begin)), op, n });
+    }
+
+    std::vector<u32> rows;
+    if (conditions.empty()) {
+        rows.resize(size());
+        std::iota(rows.begin(), rows.end(), 0);
+        return rows;
+    }
+
+    for (usize i = 0; i < conditions.size(); ++i) {
+        const condition &c = conditions[i];
+        const bool first = i == 0;
+        std::visit(
+            [&](const auto *column) {
+                const u32 v = c.value;
+                if (c.op == "=")
+                    filter_rows(*column, [v](u32 x) { return x == v; }, first, rows);
+                else if (c.op == "!=")
+                    filter_rows(*column, [v](u32 x) { return x != v; }, first, rows);
+                else if (c.op == "<")
+                    filter_rows(*column, [v](u32 x) { return x < v; }, first, rows);
+                else if (c.op == "<=")
+                    filter_rows(*column, [v](u32 x) { return x <= v; }, first, rows);
+                else if (c.op == ">")
+                    filter_rows(*column, [v](u32 x) { return x > v; }, first, rows);
+                else
+                    filter_rows(*column, [v](u32 x) { return x >= v; }, first, rows);
+            },
+            c.column);
+    }
+    return rows;
+}
+
+bool parse_index_args(int argc, char *argv[], index_options &out)
+{
+    bool requested = false;
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *next = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (strcmp(arg, "--index") == 0) {
+            if (next == nullptr)
+                throw std::runtime_error("--index expects a directory");
+            out.directory = next;
+            out.update = true;
+            requested = true;
+            ++i;
+        } else if (strcmp(arg, "--query") == 0) {
+            if (next == nullptr)
+                throw std::runtime_error("--query expects a query");
+            out.query = next;
+            requested = true;
+            ++i;
+        } else if (strcmp(arg, "--index-file") == 0) {
+            if (next == nullptr)
+                throw std::runtime_error("--index-file expects a path");
+            out.index_file = next;
+            ++i;
+        } else if (strcmp(arg, "--jobs") == 0) {
+            out.jobs = parse_uint_arg(arg, next, MAX_JOBS);
+            ++i;
+        } else if (strcmp(arg, "--recursive") == 0) {
+            out.recursive = true;
+        }
+    }
+
+    if (requested && out.index_file.empty()) {
+        if (out.directory.empty())
+            throw std::runtime_error("--query without --index expects --index-file");
+        out.index_file = (fs::path { out.directory } / save_index::DEFAULT_FILE_NAME).string();
+    }
+    return requested;
+}
+
+int run_index(const index_options &opt)
+{
+    save_index index {};
+    try {
+        index = save_index::load(opt.index_file);
+    } catch (const std::exception &e) {
+        // A corrupt index is rebuilt from scratch by an update.
+        fprintf(stderr, "index: %s\n", e.what());
+        if (!opt.update)
+            return EXIT_FAILURE;
+    }
+
+    if (opt.update) {
+        save_index::update_stats stats {};
+        try {
+            stats = index.update(opt.directory, opt.recursive, opt.jobs);
+            index.write(opt.index_file);
+        } catch (const std::exception &e) {
+            fprintf(stderr, "index: %s\n", e.what());
+            return EXIT_FAILURE;
+        }
+        for (const std::string &error : stats.errors)
+            fprintf(stderr, "index: %s\n", error.c_str());
+        printf("index: %zu save(s), %zu unchanged, %zu decoded, %zu failed, %zu Pokemon, "
+               "%.3f s\n",
+               stats.scanned, stats.reused, stats.extracted, stats.errors.size(), index.size(),
+               stats.seconds);
+        if (opt.query.empty())
+            return stats.errors.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    std::vector<u32> rows;
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        rows = index.query(opt.query);
+    } catch (const std::exception &e) {
+        fprintf(stderr, "query: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    for (u32 row : rows) {
+        const indexed_pkmn pkmn { index.record(row) };
+        printf("%s\t%s\tspecies %u\tpid 0x%08X\tot %u/%u\tivs %u/%u/%u/%u/%u/%u%s\n",
+               index.path_of(row).c_str(), save_index::describe_slot(pkmn.slot).c_str(),
+               pkmn.species, pkmn.personality_value, pkmn.ot_public_id, pkmn.ot_secret_id,
+               pkmn.ivs[0], pkmn.ivs[1], pkmn.ivs[2], pkmn.ivs[3], pkmn.ivs[4], pkmn.ivs[5],
+               pkmn.shiny ? "\tshiny" : "");
+    }
+    printf("query: %zu of %zu Pokemon matched, %.3f ms\n", rows.size(), index.size(),
+           elapsed.count());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "save_writer.h"
+#include "trace.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryFile>
+
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+#ifdef Q_OS_UNIX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef Q_OS_WIN
+#include <io.h>
+#endif
+#ifdef Q_OS_LINUX
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#endif
+
+namespace fs = std::filesystem;
+
+// Read size of a streamed backup copy.
+static constexpr qint64 BACKUP_CHUNK_SIZE = 256 * 1024;
+
+const char *save_writer::backup_method_name(backup_method method) noexcept
+{
+    switch (method) {
+    case backup_method::Reflink:
+        return "reflink";
+    case backup_method::Copy:
+        return "copy";
+    default:
+        return "none";
+    }
+}
+
+void save_writer::track(const std::string &path, std::shared_ptr<const mapped_file> image)
+{
+    tracked_path = path;
+    disk_map = std::move(image);
+}
+
+void save_writer::clear() noexcept
+{
+    tracked_path.clear();
+    disk_map.reset();
+}
+
+// Makes `dst_fd` share the extents of `src_path` (FICLONE). Returns false when
+// the platform or filesystem has no reflink support.
+static bool clone_file(const std::string &src_path, int dst_fd)
+{
+#ifdef Q_OS_LINUX
+    const int src_fd = ::open(src_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (src_fd < 0)
+        return false;
+    const bool ok = ::ioctl(dst_fd, FICLONE, src_fd) == 0;
+    ::close(src_fd);
+    return ok;
+#else
+    (void)src_path;
+    (void)dst_fd;
+    return false;
+#endif
+}
+
+// After rename() the new directory entry is only durable once the directory
+// itself has been synced.
+static void sync_parent_dir(const std::string &path)
+{
+#ifdef Q_OS_UNIX
+    const QFileInfo info { QString::fromStdString(path) };
+    const std::string dir { info.absolutePath().toStdString() };
+    const int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+        return;
+    ::fsync(fd);
+    ::close(fd);
+#else
+    (void)path;
+#endif
+}
+
+// Flushes the file open as `fd` to the storage device.
+static bool sync_handle(int fd)
+{
+#ifdef Q_OS_WIN
+    return ::_commit(fd) == 0;
+#else
+    return ::fsync(fd) == 0;
+#endif
+}
+
+// Renames the closed temporary `temp` over `dst` once its data is on disk.
+// Throws std::runtime_error, leaving `dst` untouched, if either step fails.
+static void commit_temp(QTemporaryFile &temp, const std::string &dst)
+{
+    // Reopening a closed QTemporaryFile opens the same file again.
+    const std::string temp_path { temp.fileName().toStdString() };
+    if (!temp.open() || !sync_handle(temp.handle()))
+        throw std::runtime_error("Unable to flush " + temp_path + " to disk: " +
+                                 temp.errorString().toStdString());
+    temp.close();
+
+    std::error_code error;
+    fs::rename(temp_path, dst, error);
+    if (error)
+        throw std::runtime_error("Unable to replace " + dst + ": " + error.message());
+    temp.setAutoRemove(false);
+    sync_parent_dir(dst);
+}
+
+// Copies `path`, as it is on disk now, to `<path>.bak`. The copy goes to a
+// temporary file that is fsync'd and renamed over the old backup, so a
+// failed backup leaves the previous one intact.
+//
+// A FICLONE reflink shares the original's extents instead of copying them,
+// but only Btrfs, XFS and a few other Linux filesystems support it. Anywhere
+// else the single streamed copy is the normal case. Hard links are
+// deliberately not used: emulators rewrite .sav files in place, which would
+// silently change a backup sharing the original's inode.
+static save_writer::backup_method write_backup(const std::string &path)
+{
+    PKEDIT_TRACE_SCOPE("save_writer::backup");
+    using method = save_writer::backup_method;
+    const QString src { QString::fromStdString(path) };
+    const QString dst { src + ".bak" };
+    auto fail = [&](const QString &reason) {
+        throw std::runtime_error("Unable to write backup " + dst.toStdString() + ": " +
+                                 reason.toStdString());
+    };
+
+    QTemporaryFile temp { dst + ".XXXXXX" };
+    if (!temp.open())
+        fail(temp.errorString());
+
+    method used = method::Reflink;
+    if (!clone_file(path, temp.handle())) {
+        used = method::Copy;
+        QFile original { src };
+        if (!original.open(QIODevice::ReadOnly))
+            fail(original.errorString());
+        std::vector<char> chunk(BACKUP_CHUNK_SIZE);
+        for (;;) {
+            const qint64 n = original.read(chunk.data(), static_cast<qint64>(chunk.size()));
+            if (n < 0)
+                fail(original.errorString());
+            if (n == 0)
+                break;
+            if (temp.write(chunk.data(), n) != n)
+                fail(temp.errorString());
+        }
+    }
+    temp.setPermissions(QFile::permissions(src));
+    temp.close();
+    commit_temp(temp, dst.toStdString());
+    return used;
+}
+
+save_writer::write_stats save_writer::write(const std::string &path, pkmn_save &save,
+                                            bool backup)
+{
+    PKEDIT_TRACE_SCOPE("save_writer::write");
+    write_stats stats {};
+    QElapsedTimer timer;
+    timer.start();
+
+    const QString qpath { QString::fromStdString(path) };
+    if (backup && QFileInfo::exists(qpath)) {
+        QElapsedTimer backup_timer;
+        backup_timer.start();
+        stats.backup = write_backup(path);
+        stats.backup_ms = backup_timer.nsecsElapsed() / 1e6;
+    }
+
+    // libpkedit writes by path, so it is handed a temporary name in the
+    // destination's directory: the rename must not cross filesystems. The
+    // temporary is removed unless the rename succeeds.
+    QTemporaryFile temp { qpath + ".XXXXXX" };
+    if (!temp.open())
+        throw std::runtime_error("Unable to create a temporary file for " + path + ": " +
+                                 temp.errorString().toStdString());
+    if (QFileInfo::exists(qpath))
+        temp.setPermissions(QFile::permissions(qpath));
+    const std::string temp_path { temp.fileName().toStdString() };
+    temp.close();
+
+    {
+        PKEDIT_TRACE_SCOPE("write_pkmn_save_file");
+        write_pkmn_save_file(temp_path.c_str(), save, false);
+    }
+    stats.bytes_written = QFileInfo { temp.fileName() }.size();
+
+    {
+        PKEDIT_TRACE_SCOPE("save_writer::commit");
+        commit_temp(temp, path);
+    }
+
+    if (!tracked_path.empty()) {
+        try {
+            track(path, read_image(path));
+        } catch (const std::exception &) {
+            clear();
+        }
+    }
+    stats.save_ms = timer.nsecsElapsed() / 1e6;
+    return stats;
+}
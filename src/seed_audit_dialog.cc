@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "seed_audit_dialog.h"
+
+#include <QHeaderView>
+#include <QLabel>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+#include <algorithm>
+
+static QString hex32(u32 value)
+{
+    return QString::number(value, 16).rightJustified(8, '0').toUpper();
+}
+
+static QString method_name(rng_method method)
+{
+    switch (method) {
+        default:
+            return QStringLiteral("-");
+        case rng_method::Method_1:
+            return QStringLiteral("Method 1");
+        case rng_method::Method_2:
+            return QStringLiteral("Method 2");
+        case rng_method::Method_4:
+            return QStringLiteral("Method 4");
+    }
+}
+
+seed_audit_dialog::seed_audit_dialog(const seed_audit &audit, QWidget *parent) : QDialog(parent)
+{
+    setWindowTitle("RNG Seeds");
+    resize(700, 450);
+
+    int rows = 0;
+    usize matched = 0;
+    for (const seed_audit_entry &entry : audit.entries) {
+        rows += std::max<int>(1, static_cast<int>(entry.matches.size()));
+        matched += !entry.matches.empty();
+    }
+
+    auto *summary = new QLabel(this);
+    summary->setText(QString("%1 of %2 Pokemon drawn by method 1, 2 or 4, searched in %3 ms "
+                             "(table %4 in %5 ms); frames are counted from seed 0")
+                         .arg(matched)
+                         .arg(audit.entries.size())
+                         .arg(audit.search_ms, 0, 'f', 3)
+                         .arg(audit.cached ? "mapped" : "built in memory")
+                         .arg(audit.table_ms, 0, 'f', 3));
+
+    auto *table = new QTableWidget(rows, SEED_TABLE_COLUMN_COUNT, this);
+    table->setHorizontalHeaderLabels({ "Slot", "PID", "IVs", "Method", "Seed", "Frame" });
+    table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    table->setShowGrid(false);
+    table->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    table->horizontalHeader()->setStretchLastSection(true);
+
+    int row = 0;
+    auto add_row = [&](const seed_audit_entry &entry, const seed_match *match) {
+        auto *slot =
+            new QTableWidgetItem(QString::fromStdString(save_index::describe_slot(entry.slot)));
+        slot->setData(Qt::UserRole, entry.slot);
+        table->setItem(row, SEED_TABLE_SLOT_COL, slot);
+        table->setItem(row, SEED_TABLE_PID_COL, new QTableWidgetItem(hex32(entry.pid)));
+        table->setItem(row, SEED_TABLE_IVS_COL,
+                       new QTableWidgetItem(QStringLiteral("%1/%2/%3/%4/%5/%6")
+                                                .arg(entry.ivs[0])
+                                                .arg(entry.ivs[1])
+                                                .arg(entry.ivs[2])
+                                                .arg(entry.ivs[3])
+                                                .arg(entry.ivs[4])
+                                                .arg(entry.ivs[5])));
+        table->setItem(row, SEED_TABLE_METHOD_COL,
+                       new QTableWidgetItem(match ? method_name(match->method) : "None"));
+        table->setItem(row, SEED_TABLE_SEED_COL,
+                       new QTableWidgetItem(match ? hex32(match->seed) : "-"));
+        table->setItem(row, SEED_TABLE_FRAME_COL,
+                       new QTableWidgetItem(match ? QString::number(match->frame) : "-"));
+        ++row;
+    };
+    for (const seed_audit_entry &entry : audit.entries) {
+        if (entry.matches.empty())
+            add_row(entry, nullptr);
+        for (const seed_match &match : entry.matches)
+            add_row(entry, &match);
+    }
+
+    connect(table, &QTableWidget::cellDoubleClicked, this, [this, table](int r, int) {
+        emit pkmn_requested(
+            static_cast<u16>(table->item(r, SEED_TABLE_SLOT_COL)->data(Qt::UserRole).toUInt()));
+    });
+
+    auto *layout = new QVBoxLayout(this);
+    layout->addWidget(summary);
+    layout->addWidget(table);
+}
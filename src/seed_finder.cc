@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "seed_finder.h"
+#include "pc_boxes.h"
+#include "trace.h"
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QSaveFile>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+// Table layout, in host byte order: the header, then the 65536 products
+// `x * TABLE_MULTIPLIER` in ascending order, then the `x` of each product.
+struct table_header {
+    char magic[8];
+    u32 count;
+    u32 multiplier;
+};
+
+static constexpr char TABLE_MAGIC[8] = { 'P', 'K', 'E', 'S', 'E', 'E', 'D', '1' };
+static constexpr u32 TABLE_COUNT = 0x10000;
+static constexpr u32 TABLE_MULTIPLIER = gen3_lcg_next(1) - gen3_lcg_next(0);
+static constexpr qsizetype TABLE_SIZE =
+    sizeof(table_header) + TABLE_COUNT * (sizeof(u32) + sizeof(u16));
+static_assert(sizeof(table_header) == 16);
+
+static constexpr std::array<rng_method, 3> METHODS { rng_method::Method_1, rng_method::Method_2,
+                                                     rng_method::Method_4 };
+
+u32 gen3_lcg_distance(u32 from, u32 to)
+{
+    // Bit i of the distance is the only one left that can change bit i of
+    // the state, so the bits are settled from the lowest up, jumping 2^i
+    // calls with the composed multiplier and increment.
+    u32 mult = TABLE_MULTIPLIER;
+    u32 add = gen3_lcg_next(0);
+    u32 distance = 0;
+    for (u32 bit = 0; bit < 32; ++bit) {
+        if (((from ^ to) >> bit) & 1) {
+            from = from * mult + add;
+            distance |= 1u << bit;
+        }
+        add *= mult + 1;
+        mult *= mult;
+    }
+    return distance;
+}
+
+static bool valid_table(const QByteArray &bytes)
+{
+    if (bytes.size() != TABLE_SIZE ||
+        reinterpret_cast<quintptr>(bytes.constData()) % alignof(u32) != 0)
+        return false;
+
+    table_header header;
+    memcpy(&header, bytes.constData(), sizeof(header));
+    return memcmp(header.magic, TABLE_MAGIC, sizeof(TABLE_MAGIC)) == 0 &&
+           header.count == TABLE_COUNT && header.multiplier == TABLE_MULTIPLIER;
+}
+
+static QByteArray build_table()
+{
+    PKEDIT_TRACE_SCOPE("seed_finder::build_table");
+    std::vector<std::pair<u32, u16>> products(TABLE_COUNT);
+    for (u32 x = 0; x < TABLE_COUNT; ++x)
+        products[x] = { x * TABLE_MULTIPLIER, static_cast<u16>(x) };
+    std::sort(products.begin(), products.end());
+
+    QByteArray bytes(TABLE_SIZE, Qt::Uninitialized);
+    table_header header {};
+    memcpy(header.magic, TABLE_MAGIC, sizeof(TABLE_MAGIC));
+    header.count = TABLE_COUNT;
+    header.multiplier = TABLE_MULTIPLIER;
+    memcpy(bytes.data(), &header, sizeof(header));
+
+    char *product_out = bytes.data() + sizeof(header);
+    char *x_out = product_out + TABLE_COUNT * sizeof(u32);
+    for (u32 i = 0; i < TABLE_COUNT; ++i) {
+        memcpy(product_out + i * sizeof(u32), &products[i].first, sizeof(u32));
+        memcpy(x_out + i * sizeof(u16), &products[i].second, sizeof(u16));
+    }
+    return bytes;
+}
+
+static bool write_table(const QString &path, const QByteArray &bytes)
+{
+    if (!QDir {}.mkpath(QFileInfo { path }.absolutePath()))
+        return false;
+
+    QSaveFile file { path };
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+    if (file.write(bytes) != bytes.size()) {
+        file.cancelWriting();
+        return false;
+    }
+    return file.commit();
+}
+
+static std::shared_ptr<const mapped_file> map_table(const QString &path)
+{
+    try {
+        std::shared_ptr<const mapped_file> file { mapped_file::open(path.toStdString()) };
+        return valid_table(file->bytes()) ? file : nullptr;
+    } catch (const std::exception &) {
+        return nullptr;
+    }
+}
+
+seed_finder seed_finder::open(const QString &path)
+{
+    PKEDIT_TRACE_SCOPE("seed_finder::open");
+    seed_finder out {};
+    out.file = map_table(path);
+    if (out.file == nullptr) {
+        QByteArray built { build_table() };
+        if (write_table(path, built))
+            out.file = map_table(path);
+        if (out.file == nullptr)
+            out.table = std::move(built);
+    }
+    if (out.file != nullptr)
+        out.table = out.file->bytes();
+    return out;
+}
+
+std::vector<seed_match> seed_finder::find(u32 pid, const std::array<u8, 6> &ivs) const
+{
+    std::vector<seed_match> out;
+    const u32 *products = reinterpret_cast<const u32 *>(table.constData() + sizeof(table_header));
+    const u32 *products_end = products + TABLE_COUNT;
+    const u16 *lows = reinterpret_cast<const u16 *>(products_end);
+
+    // The first state is (low << 16) | x for an unknown x, and the next one
+    // is base + x * multiplier, whose top half must be the PID's high half.
+    const u32 low = pid & 0xFFFF;
+    const u32 high = pid >> 16;
+    const u32 base = gen3_lcg_next(low << 16);
+    const u32 first = (high << 16) - base;
+    const u32 last = first + 0xFFFF;
+
+    auto scan = [&](u32 from, u32 to) {
+        for (const u32 *it = std::lower_bound(products, products_end, from);
+             it != products_end && *it <= to; ++it) {
+            const u32 state = (low << 16) | lows[it - products];
+            const u32 pid_state = gen3_lcg_next(state);
+            for (const rng_method method : METHODS) {
+                if (gen3_method_ivs(method, pid_state) != ivs)
+                    continue;
+                const u32 seed = gen3_lcg_prev(state);
+                out.push_back({ method, seed, gen3_lcg_distance(0, seed) });
+            }
+        }
+    };
+    if (last < first) {
+        scan(first, 0xFFFFFFFFu);
+        scan(0, last);
+    } else {
+        scan(first, last);
+    }
+
+    std::sort(out.begin(), out.end(), [](const seed_match &a, const seed_match &b) {
+        return std::pair { a.method, a.frame } < std::pair { b.method, b.frame };
+    });
+    return out;
+}
+
+seed_audit audit_seeds(const QString &table_path, const std::vector<indexed_pkmn> &party,
+                       std::shared_ptr<const mapped_file> image)
+{
+    PKEDIT_TRACE_SCOPE("audit_seeds");
+    seed_audit out {};
+    QElapsedTimer clock;
+    clock.start();
+    const seed_finder finder { seed_finder::open(table_path) };
+    out.cached = finder.is_cached();
+    out.table_ms = clock.nsecsElapsed() / 1e6;
+
+    clock.restart();
+    auto check = [&](const indexed_pkmn &pkmn) {
+        out.entries.push_back({ pkmn.slot, pkmn.personality_value, pkmn.ivs,
+                                finder.find(pkmn.personality_value, pkmn.ivs) });
+    };
+    for (const indexed_pkmn &pkmn : party)
+        if (pkmn.generation == 3)
+            check(pkmn);
+
+    gen3_pc_boxes boxes;
+    if (image != nullptr && boxes.open(std::move(image))) {
+        for (int slot = 0; slot < gen3_pc_boxes::SLOT_COUNT; ++slot) {
+            const boxed_pkmn pkmn { boxes.decode(slot) };
+            if (!pkmn.empty && !pkmn.corrupt)
+                check(index_boxed_pkmn(pkmn, slot));
+        }
+    }
+    out.search_ms = clock.nsecsElapsed() / 1e6;
+    return out;
+}
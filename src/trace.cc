@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "trace.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+    struct trace_event {
+        const char *name;
+        trace_clock::time_point start;
+        trace_clock::time_point end;
+        unsigned tid;
+    };
+
+    struct trace_state {
+        std::string path {};
+        bool enabled { false };
+        trace_clock::time_point epoch { trace_clock::now() };
+        std::mutex mutex {};
+        std::vector<trace_event> events {};
+
+        trace_state()
+        {
+            const char *env = getenv("PKEDIT_TRACE");
+            if (env != nullptr && *env != '\0' && strcmp(env, "0") != 0) {
+                path = strcmp(env, "1") == 0 ? "pkedit-trace.json" : env;
+                enabled = true;
+                events.reserve(4096);
+            }
+        }
+    };
+
+    trace_state &state()
+    {
+        static trace_state s {};
+        return s;
+    }
+
+    unsigned current_tid() noexcept
+    {
+        static std::atomic<unsigned> next_tid { 1 };
+        thread_local const unsigned tid = next_tid.fetch_add(1, std::memory_order_relaxed);
+        return tid;
+    }
+} // namespace
+
+bool trace_enabled() noexcept
+{
+#ifdef PKEDIT_TRACING
+    static const bool enabled = state().enabled;
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+void trace_record(const char *name, trace_clock::time_point start,
+                  trace_clock::time_point end) noexcept
+{
+    trace_state &s = state();
+    const unsigned tid = current_tid();
+    try {
+        std::lock_guard lock { s.mutex };
+        s.events.push_back({ name, start, end, tid });
+    } catch (...) {
+        // Dropping an event is preferable to taking down the editor.
+    }
+}
+
+void trace_flush() noexcept
+{
+    if (!trace_enabled())
+        return;
+
+    trace_state &s = state();
+    std::lock_guard lock { s.mutex };
+    FILE *fp = fopen(s.path.c_str(), "w");
+    if (fp == nullptr) {
+        fprintf(stderr, "trace: unable to open %s for writing\n", s.path.c_str());
+        return;
+    }
+
+    using us = std::chrono::duration<double, std::micro>;
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", fp);
+    for (size_t i = 0; i < s.events.size(); ++i) {
+        const trace_event &e = s.events[i];
+        fprintf(fp, "%s\n{\"name\":\"%s\",\"cat\":\"pkedit\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                    "\"ts\":%.3f,\"dur\":%.3f}",
+                i == 0 ? "" : ",", e.name, e.tid, us(e.start - s.epoch).count(),
+                us(e.end - e.start).count());
+    }
+    fputs("\n]}\n", fp);
+    fclose(fp);
+    s.events.clear();
+}
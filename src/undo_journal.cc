@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: GPL-3.0
+// Copyright (C) 2025 Abdur-Rahman Mansoor
+
+#include "undo_journal.h"
+
+#include <cassert>
+#include <utility>
+
+static bool has_text(const undo_step &step) noexcept
+{
+    return step.type != undo_step::Field && step.type != undo_step::Pid_Traits;
+}
+
+static bool is_pkmn_step(const undo_step &step) noexcept
+{
+    return step.target != undo_journal::TRAINER &&
+           (step.type == undo_step::Field || step.type == undo_step::Text_Field ||
+            step.type == undo_step::Pid_Traits);
+}
+
+undo_journal::undo_journal(usize limit) : limit(limit)
+{
+    clock.start();
+}
+
+void undo_journal::drop_redo_steps()
+{
+    while (steps.size() > cursor) {
+        if (has_text(steps.back())) {
+            texts.pop_back();
+            texts.pop_back();
+        }
+        steps.pop_back();
+    }
+}
+
+void undo_journal::pop_front_step()
+{
+    if (has_text(steps.front())) {
+        texts.pop_front();
+        texts.pop_front();
+        text_base += 2;
+    }
+    steps.pop_front();
+    --cursor;
+}
+
+void undo_journal::push(undo_step step)
+{
+    step.joined = grouping && group_started;
+    group_started = grouping;
+    steps.push_back(step);
+    ++cursor;
+    if (steps.size() > limit) {
+        // Half a group can't be undone, so the rest of it goes too.
+        do {
+            pop_front_step();
+        } while (!steps.empty() && steps.front().joined);
+    }
+}
+
+void undo_journal::record(undo_step step)
+{
+    drop_redo_steps();
+    step.time_ms = static_cast<unsigned>(clock.elapsed());
+
+    // Holding a spin box arrow or typing commits many times; keep one step.
+    if (!grouping && !steps.empty() && step.type == undo_step::Field) {
+        undo_step &top = steps.back();
+        if (top.type == step.type && top.field == step.field && top.target == step.target &&
+            step.time_ms - top.time_ms <= MERGE_WINDOW_MS) {
+            top.after = step.after;
+            top.time_ms = step.time_ms;
+            if (top.before == top.after) {
+                steps.pop_back();
+                --cursor;
+            }
+            return;
+        }
+    }
+
+    push(step);
+}
+
+void undo_journal::record(undo_step step, const QString &before, const QString &after)
+{
+    assert(has_text(step));
+    drop_redo_steps();
+    step.time_ms = static_cast<unsigned>(clock.elapsed());
+
+    if (!grouping && !steps.empty() && step.type == undo_step::Text_Field) {
+        undo_step &top = steps.back();
+        if (top.type == step.type && top.field == step.field && top.target == step.target &&
+            step.time_ms - top.time_ms <= MERGE_WINDOW_MS) {
+            texts.back() = after;
+            top.time_ms = step.time_ms;
+            if (texts[texts.size() - 2] == after) {
+                texts.pop_back();
+                texts.pop_back();
+                steps.pop_back();
+                --cursor;
+            }
+            return;
+        }
+    }
+
+    step.text = static_cast<unsigned>(text_base + texts.size());
+    texts.push_back(before);
+    texts.push_back(after);
+    push(step);
+}
+
+void undo_journal::begin_group() noexcept
+{
+    grouping = true;
+    group_started = false;
+}
+
+void undo_journal::end_group() noexcept
+{
+    grouping = false;
+    group_started = false;
+}
+
+std::vector<const undo_step *> undo_journal::undo()
+{
+    if (!can_undo())
+        return {};
+    usize begin = cursor - 1;
+    while (begin > 0 && steps[begin].joined)
+        --begin;
+    std::vector<const undo_step *> out;
+    for (usize i = begin; i < cursor; ++i)
+        out.push_back(&steps[i]);
+    cursor = begin;
+    return out;
+}
+
+std::vector<const undo_step *> undo_journal::redo()
+{
+    if (!can_redo())
+        return {};
+    std::vector<const undo_step *> out { &steps[cursor++] };
+    while (cursor < steps.size() && steps[cursor].joined)
+        out.push_back(&steps[cursor++]);
+    return out;
+}
+
+const QString &undo_journal::text_before(const undo_step &step) const
+{
+    assert(has_text(step) && step.text >= text_base);
+    return texts[step.text - text_base];
+}
+
+const QString &undo_journal::text_after(const undo_step &step) const
+{
+    assert(has_text(step) && step.text >= text_base);
+    return texts[step.text - text_base + 1];
+}
+
+void undo_journal::remove_party_slot(int slot)
+{
+    std::deque<undo_step> kept_steps;
+    std::deque<QString> kept_texts;
+    usize kept_cursor = 0;
+    // The first step of a group was dropped, so the next kept one starts it.
+    bool group_head_dropped = false;
+    for (usize i = 0; i < steps.size(); ++i) {
+        undo_step step { steps[i] };
+        if (is_pkmn_step(step) && step.target == slot) {
+            group_head_dropped = group_head_dropped || !step.joined;
+            continue;
+        }
+        if (is_pkmn_step(step) && step.target > slot)
+            --step.target;
+        if (step.joined && group_head_dropped)
+            step.joined = false;
+        if (!step.joined)
+            group_head_dropped = false;
+        if (has_text(step)) {
+            step.text = static_cast<unsigned>(text_base + kept_texts.size());
+            kept_texts.push_back(text_before(steps[i]));
+            kept_texts.push_back(text_after(steps[i]));
+        }
+        kept_steps.push_back(step);
+        if (i < cursor)
+            ++kept_cursor;
+    }
+
+    steps = std::move(kept_steps);
+    texts = std::move(kept_texts);
+    cursor = kept_cursor;
+}
+
+void undo_journal::clear() noexcept
+{
+    steps.clear();
+    texts.clear();
+    text_base = 0;
+    cursor = 0;
+}
+
+usize undo_journal::memory_usage() const noexcept
+{
+    usize bytes = steps.size() * sizeof(undo_step) + texts.size() * sizeof(QString);
+    for (const QString &text : texts)
+        bytes += text.capacity() * sizeof(QChar);
+    return bytes;
+}
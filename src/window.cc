@@ -2,18 +2,36 @@
 // Copyright (C) 2025 Abdur-Rahman Mansoor
 
 #include "window.h"
+#include "diff_dialog.h"
+#include "seed_audit_dialog.h"
 #include "location.h"
 #include "rng.h"
 #include "save.h"
+#include "trace.h"
 #include "trainer.h"
 #include "ui_mainwindow.h"
 
 #include <QDebug>
 #include <QFileDialog>
+#include <QFileInfo>
+#include <QDockWidget>
+#include <QFutureWatcher>
+#include <QHeaderView>
+#include <QInputDialog>
 #include <QMessageBox>
 #include <QPushButton>
-
+#include <QScopeGuard>
+#include <QSignalBlocker>
+#include <QStandardPaths>
+#include <QStatusBar>
+#include <QTabBar>
+#include <QTimer>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <utility>
 
 #define QFILEDIALOG_FILTER "Save Files (*.sav);;All Files (*)"
 
@@ -23,15 +41,6 @@ enum {
     WINDOW_TAB_WIDGET_PKMN_EDITOR = 2,
     WINDOW_TAB_WIDGET_ITEMS = 3,
 
-    PKMN_TABLE_NICKNAME_COL = 0,
-    PKMN_TABLE_GENDER_COL = 1,
-    PKMN_TABLE_LEVEL_COL = 2,
-    PKMN_TABLE_SHINY_COL = 3,
-    PKMN_TABLE_EGG_COL = 4,
-
-    ITEM_TABLE_NAME_COL = 0,
-    ITEM_TABLE_QUANTITY_COL = 1,
-
     PKMN_EDITOR_TAB_WIDGET_DESCRIPTION = 0,
     PKMN_EDITOR_TAB_WIDGET_MET_CONDITIONS = 1,
     PKMN_EDITOR_TAB_WIDGET_STATS = 2,
@@ -49,32 +58,253 @@ enum {
     PKMN_STATUS_COMBOBOX_SLP = 3,
     PKMN_STATUS_COMBOBOX_FRZ = 4,
     PKMN_STATUS_COMBOBOX_BRN = 5,
+
+    // How long a field must stay unchanged before its edit is committed.
+    SPINBOX_EDIT_DEBOUNCE_MS = 60,
+    TEXT_EDIT_DEBOUNCE_MS = 250,
 };
 
-static void save_file(const QString &file_name, pkmn_save &save, const options &opt)
+// Result of a load or save run on a worker thread. Exceptions are turned into
+// an error message so they can be shown once the operation finishes.
+struct io_result {
+    pkmn_save save {};
+    std::shared_ptr<const mapped_file> image {};
+    save_writer::write_stats write_stats {};
+    std::string error {};
+};
+
+static QString describe_write(const save_writer::write_stats &stats)
+{
+    QString text { QString(" in %1 ms (%2 bytes)")
+                       .arg(stats.save_ms, 0, 'f', 1)
+                       .arg(stats.bytes_written) };
+    if (stats.backup != save_writer::backup_method::None)
+        text += QString(", backup %1 in %2 ms")
+                    .arg(save_writer::backup_method_name(stats.backup))
+                    .arg(stats.backup_ms, 0, 'f', 1);
+    return text;
+}
+
+static int status_combo_index(status_condition status)
+{
+    switch (status) {
+        default:
+            throw std::runtime_error("invalid status condition");
+        case status_condition::HEALTHY:
+            return PKMN_STATUS_COMBOBOX_HEALTHY;
+        case status_condition::PAR:
+            return PKMN_STATUS_COMBOBOX_PAR;
+        case status_condition::PSN:
+            return PKMN_STATUS_COMBOBOX_PSN;
+        case status_condition::SLP:
+            return PKMN_STATUS_COMBOBOX_SLP;
+        case status_condition::FRZ:
+            return PKMN_STATUS_COMBOBOX_FRZ;
+        case status_condition::BRN:
+            return PKMN_STATUS_COMBOBOX_BRN;
+    }
+}
+
+static stat_view make_stat_view(const pokemon *pkmn);
+
+static recovery_record::op item_op(undo_step::kind type)
+{
+    switch (type) {
+        case undo_step::Item_Insert:
+            return recovery_record::Item_Insert;
+        case undo_step::Item_Remove:
+            return recovery_record::Item_Remove;
+        default:
+            return recovery_record::Item_Edit;
+    }
+}
+
+// Bits of each PID trait field's value in a Pid_Traits step, in the order of
+// MainWindow::pid_trait_fields().
+static constexpr std::array<unsigned, 4> PID_TRAIT_BITS { 2, 5, 1, 2 };
+
+static std::optional<unsigned> pack_pid_traits(const std::array<int, 4> &values)
+{
+    unsigned packed = 0;
+    unsigned shift = 0;
+    for (usize i = 0; i < values.size(); ++i) {
+        if (values[i] < 0 || values[i] >= (1 << PID_TRAIT_BITS[i]))
+            return std::nullopt;
+        packed |= static_cast<unsigned>(values[i]) << shift;
+        shift += PID_TRAIT_BITS[i];
+    }
+    return packed;
+}
+
+static std::array<int, 4> unpack_pid_traits(unsigned packed)
 {
-    if (file_name.isEmpty())
+    std::array<int, 4> values {};
+    for (usize i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int>(packed & ((1u << PID_TRAIT_BITS[i]) - 1));
+        packed >>= PID_TRAIT_BITS[i];
+    }
+    return values;
+}
+
+// Row of the first (or last) stack of `name` in the model's pocket, or -1.
+static int find_item_row(const item_table_model *model, const QString &name, bool last = false)
+{
+    int found = -1;
+    for (int row = 0; row < model->rowCount(); ++row) {
+        if (QString::fromUtf8(model->item_at(row)->name()) != name)
+            continue;
+        found = row;
+        if (!last)
+            break;
+    }
+    return found;
+}
+
+static QVariant field_value(const QWidget *field)
+{
+    if (const auto *spin_box = qobject_cast<const QSpinBox *>(field))
+        return spin_box->value();
+    if (const auto *combo_box = qobject_cast<const QComboBox *>(field))
+        return combo_box->currentIndex();
+    if (const auto *check_box = qobject_cast<const QCheckBox *>(field))
+        return check_box->isChecked();
+    if (const auto *line_edit = qobject_cast<const QLineEdit *>(field))
+        return line_edit->text();
+    return {};
+}
+
+// Sets a field's value with its signals enabled, so that the editor's own
+// handler applies it to the save.
+static void set_field_value(QWidget *field, const QVariant &value)
+{
+    if (auto *spin_box = qobject_cast<QSpinBox *>(field))
+        spin_box->setValue(value.toInt());
+    else if (auto *combo_box = qobject_cast<QComboBox *>(field))
+        combo_box->setCurrentIndex(value.toInt());
+    else if (auto *check_box = qobject_cast<QCheckBox *>(field))
+        check_box->setChecked(value.toBool());
+    else if (auto *line_edit = qobject_cast<QLineEdit *>(field))
+        line_edit->setText(value.toString());
+}
+
+// Swaps the model shown by `view`. setModel() gives the view a new selection
+// model without freeing the old one.
+static void set_view_model(QTableView *view, QAbstractItemModel *model)
+{
+    if (view->model() == model)
         return;
+    QItemSelectionModel *old_selection = view->selectionModel();
+    view->setModel(model);
+    delete old_selection;
+}
 
-    save.trainer->save();
-    write_pkmn_save_file(file_name.toStdString().c_str(), save, opt.backup_save);
+// Whether `a` and `b` name the same file, through symbolic links and
+// relative paths.
+static bool same_file(const QString &a, const QString &b)
+{
+    const QString canonical { QFileInfo { a }.canonicalFilePath() };
+    if (canonical.isEmpty())
+        return QFileInfo { a }.absoluteFilePath() == QFileInfo { b }.absoluteFilePath();
+    return canonical == QFileInfo { b }.canonicalFilePath();
+}
+
+static save_writer::write_stats save_file(const std::string &file_name, pkmn_save &save,
+                                          const options &opt, save_writer &writer)
+{
+    PKEDIT_TRACE_SCOPE("save_file");
+    if (file_name.empty())
+        return {};
+
+    {
+        PKEDIT_TRACE_SCOPE("trainer::save");
+        save.trainer->save();
+    }
+    return writer.write(file_name, save, opt.backup_save);
 }
 
-MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWindow)
+MainWindow::MainWindow(std::shared_future<void> ready, QWidget *parent)
+    : QMainWindow(parent), pkedit_ready(std::move(ready)), ui(new Ui::MainWindow)
 {
     ui->setupUi(this);
-    ui->partyTableWidget->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    ui->partyTableView->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    edits = new edit_coalescer(this);
+
+    // Stat refreshes requested by edits are applied at most once per frame.
+    stats_refresh_timer = new QTimer(this);
+    stats_refresh_timer->setSingleShot(true);
+    stats_refresh_timer->setInterval(16);
+    connect(stats_refresh_timer, &QTimer::timeout, this, [this] { update_stats_on_ui(sel_pkmn); });
+    empty_models = create_save_models();
+    use_models(empty_models);
+
+    // Fixed row heights keep the view from sizing every slot up front, so
+    // only the rows scrolled into view are decoded.
+    ui->pcBoxTableView->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
     ui->saveLoadedLabel->setStyleSheet("font: 16pt \"Sans Serif\"; color: red;");
-    sel_item_table_widget = ui->itemsTableWidget;
+
+    // Every open save gets a tab above the editor tabs.
+    save_tabs = new QTabBar(this);
+    save_tabs->setTabsClosable(true);
+    save_tabs->setMovable(false);
+    save_tabs->setDocumentMode(true);
+    save_tabs->setExpanding(false);
+    ui->verticalLayout_4->insertWidget(0, save_tabs);
+    connect(save_tabs, &QTabBar::currentChanged, this, [this](int index) { switch_save(index); });
+    connect(save_tabs, &QTabBar::tabCloseRequested, this, [this](int index) { close_save(index); });
+
+    // Legality issues of the shown save, filled in by a background scan.
+    legality = new legality_panel(this);
+    auto *legality_dock = new QDockWidget("Legality", this);
+    legality_dock->setObjectName("legalityDock");
+    legality_dock->setWidget(legality);
+    addDockWidget(Qt::BottomDockWidgetArea, legality_dock);
+    ui->menuOptions->addAction(legality_dock->toggleViewAction());
+    connect(legality, &legality_panel::rescan_requested, this, [this] { start_legality_scan(); });
+    connect(legality, &legality_panel::pkmn_requested, this,
+            [this](u16 slot) { show_pkmn_in_slot(slot); });
+
+    io_progress_bar = new QProgressBar(this);
+    io_progress_bar->setRange(0, 0);
+    io_progress_bar->setMaximumWidth(150);
+    io_progress_bar->hide();
+    statusBar()->addPermanentWidget(io_progress_bar);
+
+    // These combo boxes display shared models from combo_models, so typing an
+    // unknown name into them must never insert it.
+    for (QComboBox *combo_box :
+         { ui->speciesComboBox, ui->heldItemComboBox, ui->locationComboBox, ui->m1ComboBox,
+           ui->m2ComboBox, ui->m3ComboBox, ui->m4ComboBox, ui->itemNameComboBox })
+        combo_box->setInsertPolicy(QComboBox::NoInsert);
+
+    // Type-ahead search over the large static name lists. The held item combo
+    // box is only editable for the sake of the search.
+    ui->heldItemComboBox->setEditable(true);
+    for (QComboBox *combo_box :
+         { ui->speciesComboBox, ui->heldItemComboBox, ui->locationComboBox, ui->m1ComboBox,
+           ui->m2ComboBox, ui->m3ComboBox, ui->m4ComboBox })
+        name_searches.push_back(new combo_name_search(combo_box, combo_models));
+
+    sel_item_table_view = ui->itemsTableView;
 
     auto get_item_combobox_index = [this](const QString &name) -> usize {
-        for (usize i = 0; i < ui->itemNameComboBox->count(); ++i)
-            if (name == ui->itemNameComboBox->itemText(i))
-                return i;
-        throw std::runtime_error("error: unable to find item index");
+        const auto *model = qobject_cast<const QStringListModel *>(ui->itemNameComboBox->model());
+        const int row = combo_models.row_of(model, name);
+        if (row < 0)
+            throw std::runtime_error("error: unable to find item index");
+        return row;
     };
 
     connect(ui->actionOpen_File, &QAction::triggered, this, [this] { open_file(); });
+    connect(ui->actionSearch_Saves, &QAction::triggered, this, [this] {
+        if (search_dialog == nullptr) {
+            search_dialog = new index_search_dialog(pkedit_ready, this);
+            connect(search_dialog, &index_search_dialog::open_requested, this,
+                    [this](const QString &path) { open_file_path(path); });
+        }
+        search_dialog->show();
+        search_dialog->raise();
+    });
+    connect(ui->actionCompare_With, &QAction::triggered, this, [this] { compare_with_file(); });
     connect(ui->actionBackup_Save, &QAction::triggered, this,
             [this] { opt.backup_save = ui->actionBackup_Save->isChecked(); });
     connect(ui->actionSave_File, &QAction::triggered, this, [this] {
@@ -84,7 +314,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
 
             const QString filename { QFileDialog::getSaveFileName(this, "Save File", "",
                                                                   QFILEDIALOG_FILTER) };
-            save_file(filename, save, opt);
+            save_file_async(filename);
         } catch (const std::exception &e) {
             show_popup_error(e.what());
         }
@@ -96,7 +326,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
 
             const QString filename { QFileDialog::getSaveFileName(
                 this, "Save As", save.file_name.c_str(), QFILEDIALOG_FILTER) };
-            save_file(filename, save, opt);
+            save_file_async(filename);
         } catch (const std::exception &e) {
             show_popup_error(e.what());
         }
@@ -108,249 +338,274 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
         if (sel_pkmn != nullptr)
             set_pkmn_in_editor(sel_pkmn);
     });
-    connect(ui->partyTableWidget->selectionModel(), &QItemSelectionModel::selectionChanged, this,
-            [this](const QItemSelection &selected, const QItemSelection &deselected) {
-                if (ui->partyTableWidget->selectedItems().isEmpty()) {
-                    ui->editPkmnPartyPushButton->setEnabled(false);
-                    ui->deletePkmnPartyPushButton->setEnabled(false);
-                }
-            });
-    connect(ui->partyTableWidget, &QTableWidget::itemClicked, this, [this](QTableWidgetItem *sel) {
-        if (sel->row() >= save.trainer->pkmn_team().size())
-            return;
-        ui->editPkmnPartyPushButton->setEnabled(true);
-        ui->deletePkmnPartyPushButton->setEnabled(save.trainer->pkmn_team().size() > 1);
-    });
     connect(ui->editPkmnPartyPushButton, &QPushButton::clicked, this, [this]() {
-        const int row = ui->partyTableWidget->selectedItems()[0]->row();
-        sel_pkmn_table_widget = ui->partyTableWidget;
+        const int row = selected_party_row();
+        if (row < 0)
+            return;
+        sel_pkmn_table_view = ui->partyTableView;
         sel_pkmn_table_row = row;
-        set_pkmn_in_editor(save.trainer->pkmn_team()[row].get());
+        set_pkmn_in_editor(party_model->pokemon_at(row));
     });
     connect(ui->deletePkmnPartyPushButton, &QPushButton::clicked, this, [this]() {
         try {
-            if (save.trainer->pkmn_team().size() <= 1)
-                throw std::runtime_error("Cannot delete last pokemon in party");
-
-            save.trainer->remove_pkmn_from_party(ui->partyTableWidget->selectedItems()[0]->row());
-            ui->partyTableWidget->clearSelection();
+            const int row = selected_party_row();
+            if (row < 0)
+                return;
+            remove_party_pkmn(row);
+            ui->partyTableView->clearSelection();
             ui->editPkmnPartyPushButton->setEnabled(false);
             ui->deletePkmnPartyPushButton->setEnabled(false);
-            update_party_table_widget();
         } catch (const std::exception &e) {
             show_popup_error(e.what());
         }
     });
     connect(ui->itemsTabWidget, &QTabWidget::currentChanged, this,
             [this, get_item_combobox_index](int index) {
-                switch (index) {
-                    default:
-                        qDebug() << "Invalid item tab widget index";
-                        break;
-                    case 0:
-                        sel_item_table_widget = ui->itemsTableWidget;
-                        sel_item_category = item_category::Pocket;
-                        break;
-                    case 1:
-                        sel_item_table_widget = ui->ballsTableWidget;
-                        sel_item_category = item_category::Pokeball;
-                        break;
-                    case 2:
-                        sel_item_table_widget = ui->berriesTableWidget;
-                        sel_item_category = item_category::Berry;
-                        break;
-                    case 3:
-                        sel_item_table_widget = ui->tmsTableWidget;
-                        sel_item_category = item_category::Tm;
-                        break;
-                    case 4:
-                        sel_item_table_widget = ui->keyItemsTableWidget;
-                        sel_item_category = item_category::Key_Item;
-                        break;
-                    case 5:
-                        sel_item_table_widget = ui->pcItemsTableWidget;
-                        sel_item_category = item_category::Pc;
-                        break;
+                if (index < 0 || index >= static_cast<int>(item_models.size())) {
+                    qDebug() << "Invalid item tab widget index";
+                    return;
                 }
 
+                sel_item_table_view = item_table_views()[index];
+                sel_item_model = item_models[index];
+                sel_item_category = sel_item_model->item_type();
+
                 add_item_names_to_combo_box(ui->itemNameComboBox, sel_item_category);
-                const bool selected = !sel_item_table_widget->selectedItems().isEmpty();
-                ui->editItemPushButton->setEnabled(selected);
-                ui->deleteItemPushButton->setEnabled(selected);
-                if (selected) {
-                    ui->itemNameComboBox->setCurrentIndex(
-                        get_item_combobox_index(sel_item_table_widget->currentItem()->text()));
-                    ui->quantitySpinBox->setValue(
-                        sel_item_table_widget->currentItem()->text().toInt());
+                const item *sel = sel_item_table_view->selectionModel()->hasSelection()
+                                      ? sel_item_model->item_at(
+                                            sel_item_table_view->currentIndex().row())
+                                      : nullptr;
+                ui->editItemPushButton->setEnabled(sel != nullptr);
+                ui->deleteItemPushButton->setEnabled(sel != nullptr);
+                if (sel != nullptr) {
+                    ui->itemNameComboBox->setCurrentIndex(get_item_combobox_index(sel->name()));
+                    ui->quantitySpinBox->setValue(sel->count());
                 } else {
                     ui->itemNameComboBox->setCurrentIndex(0);
                     ui->quantitySpinBox->setValue(0);
                 }
             });
 
-    auto on_item_select = [this, get_item_combobox_index](QTableWidgetItem *) {
-        const QString name { sel_item_table_widget
-                                 ->item(sel_item_table_widget->currentRow(), ITEM_TABLE_NAME_COL)
-                                 ->text() };
-        const u16 quantity =
-            sel_item_table_widget
-                ->item(sel_item_table_widget->currentRow(), ITEM_TABLE_QUANTITY_COL)
-                ->text()
-                .toUInt();
-
-        ui->itemNameComboBox->clear();
+    auto on_item_select = [this, get_item_combobox_index](const QModelIndex &index) {
+        const item *sel = sel_item_model->item_at(index.row());
+        if (sel == nullptr)
+            return;
+
         add_item_names_to_combo_box(ui->itemNameComboBox, sel_item_category);
-        ui->itemNameComboBox->setCurrentIndex(get_item_combobox_index(name));
-        ui->quantitySpinBox->setValue(quantity);
+        ui->itemNameComboBox->setCurrentIndex(get_item_combobox_index(sel->name()));
+        ui->quantitySpinBox->setValue(sel->count());
         ui->editItemPushButton->setEnabled(true);
         ui->deleteItemPushButton->setEnabled(true);
     };
 
-    connect(ui->itemsTableWidget, &QTableWidget::itemClicked, this, on_item_select);
-    connect(ui->ballsTableWidget, &QTableWidget::itemClicked, this, on_item_select);
-    connect(ui->berriesTableWidget, &QTableWidget::itemClicked, this, on_item_select);
-    connect(ui->tmsTableWidget, &QTableWidget::itemClicked, this, on_item_select);
-    connect(ui->keyItemsTableWidget, &QTableWidget::itemClicked, this, on_item_select);
-    connect(ui->pcItemsTableWidget, &QTableWidget::itemClicked, this, on_item_select);
+    connect(ui->itemsTableView, &QTableView::clicked, this, on_item_select);
+    connect(ui->ballsTableView, &QTableView::clicked, this, on_item_select);
+    connect(ui->berriesTableView, &QTableView::clicked, this, on_item_select);
+    connect(ui->tmsTableView, &QTableView::clicked, this, on_item_select);
+    connect(ui->keyItemsTableView, &QTableView::clicked, this, on_item_select);
+    connect(ui->pcItemsTableView, &QTableView::clicked, this, on_item_select);
     connect(ui->addItemPushButton, &QPushButton::clicked, this, [this] {
-        const QString name { ui->itemNameComboBox->currentText() };
-        const u16 quantity = ui->quantitySpinBox->value();
-
         try {
-            save.trainer->add_item(sel_item_category, name.toStdString().c_str(), quantity);
-            sel_item_table_widget->insertRow(sel_item_table_widget->rowCount());
-            sel_item_table_widget->setItem(sel_item_table_widget->rowCount() - 1,
-                                           ITEM_TABLE_NAME_COL, new QTableWidgetItem(name));
-            sel_item_table_widget->setItem(sel_item_table_widget->rowCount() - 1,
-                                           ITEM_TABLE_QUANTITY_COL,
-                                           new QTableWidgetItem(std::to_string(quantity).c_str()));
+            const QString name { ui->itemNameComboBox->currentText() };
+            const int rows = sel_item_model->rowCount();
+            const int stack_row = find_item_row(sel_item_model, name);
+            const int stack_count =
+                stack_row >= 0 ? sel_item_model->item_at(stack_row)->count() : 0;
+            {
+                PKEDIT_TRACE_SCOPE("item_table_model::add_item");
+                sel_item_model->add_item(name, ui->quantitySpinBox->value());
+            }
+
+            // Adding either appends a stack or grows the existing one.
+            if (sel_item_model->rowCount() > rows) {
+                const int row = find_item_row(sel_item_model, name, true);
+                if (row >= 0)
+                    record_item_step(undo_step::Item_Insert, sel_item_category, row, {}, 0, name,
+                                     sel_item_model->item_at(row)->count());
+            } else if (stack_row >= 0) {
+                record_item_step(undo_step::Item_Edit, sel_item_category, stack_row, name,
+                                 stack_count, name, sel_item_model->item_at(stack_row)->count());
+            }
+            ui->editItemPushButton->setEnabled(false);
+            ui->deleteItemPushButton->setEnabled(false);
         } catch (std::exception &e) {
             show_popup_error(e.what());
         }
     });
     connect(ui->editItemPushButton, &QPushButton::clicked, this, [this] {
-        const u16 row = sel_item_table_widget->currentRow();
-        const QString name { ui->itemNameComboBox->currentText() };
-        const u16 quantity = ui->quantitySpinBox->value();
-        save.trainer->edit_item(sel_item_category, row, name.toStdString().c_str(), quantity);
-        sel_item_table_widget->removeRow(row);
-        sel_item_table_widget->insertRow(row);
-        sel_item_table_widget->setItem(row, ITEM_TABLE_NAME_COL, new QTableWidgetItem(name));
-        sel_item_table_widget->setItem(row, ITEM_TABLE_QUANTITY_COL,
-                                       new QTableWidgetItem(std::to_string(quantity).c_str()));
-        sel_item_table_widget->setCurrentItem(sel_item_table_widget->item(row, 0));
-    });
-    connect(ui->deleteItemPushButton, &QPushButton::clicked, this, [this] {
-        const u16 row = sel_item_table_widget->currentRow();
-        save.trainer->del_item(sel_item_category, row);
-        sel_item_table_widget->removeRow(row);
-    });
-    connect(ui->hpIvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_iv(ui->hpIvSpinBox, pkstat::Hp); });
-    connect(ui->atkIvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_iv(ui->atkIvSpinBox, pkstat::Atk); });
-    connect(ui->defIvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_iv(ui->defIvSpinBox, pkstat::Def); });
-    connect(ui->speIvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_iv(ui->speIvSpinBox, pkstat::Spe); });
-    connect(ui->spAtkIvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_iv(ui->spAtkIvSpinBox, pkstat::Spa); });
-    connect(ui->spDefIvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_iv(ui->spDefIvSpinBox, pkstat::Spd); });
-    connect(ui->spDvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_iv(ui->spDvSpinBox, pkstat::Spe); });
-    connect(ui->spDvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_iv(ui->spDvSpinBox, pkstat::Spe); });
-    connect(ui->hpevSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_ev(ui->hpevSpinBox, pkstat::Hp); });
-    connect(ui->atkEvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_ev(ui->atkEvSpinBox, pkstat::Atk); });
-    connect(ui->defEvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_ev(ui->defEvSpinBox, pkstat::Def); });
-    connect(ui->speEvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_ev(ui->speEvSpinBox, pkstat::Spe); });
-    connect(ui->spAtkEvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_ev(ui->spAtkEvSpinBox, pkstat::Spa); });
-    connect(ui->spDefEvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_ev(ui->spDefEvSpinBox, pkstat::Spd); });
-    connect(ui->spcEvSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this,
-            [this] { modify_ev(ui->spcEvSpinBox, pkstat::Spe); });
-    connect(ui->levelSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [this] {
         try {
-            if (sel_pkmn != nullptr) {
-                sel_pkmn->set_level(ui->levelSpinBox->value());
-                ui->expSpinBox->blockSignals(true);
-                ui->expSpinBox->setMinimum(sel_pkmn->min_exp());
-                ui->expSpinBox->setValue(sel_pkmn->exp());
-                ui->expSpinBox->setMaximum(sel_pkmn->max_exp());
-                ui->expSpinBox->blockSignals(false);
-                update_stats_on_ui(sel_pkmn);
-                if (sel_pkmn_table_widget == ui->partyTableWidget)
-                    update_party_table_widget();
+            const int row = sel_item_table_view->currentIndex().row();
+            const item *before = sel_item_model->item_at(row);
+            if (before == nullptr)
+                return;
+
+            const QString before_name { QString::fromUtf8(before->name()) };
+            const int before_count = before->count();
+            const QString name { ui->itemNameComboBox->currentText() };
+            {
+                PKEDIT_TRACE_SCOPE("item_table_model::edit_item");
+                sel_item_model->edit_item(row, name, ui->quantitySpinBox->value());
             }
-        } catch (const std::exception &e) {
+            record_item_step(undo_step::Item_Edit, sel_item_category, row, before_name,
+                             before_count, name, sel_item_model->item_at(row)->count());
+        } catch (std::exception &e) {
             show_popup_error(e.what());
         }
     });
-    connect(ui->nameLineEdit, &QLineEdit::textChanged, this, [this] {
+    connect(ui->deleteItemPushButton, &QPushButton::clicked, this, [this] {
         try {
-            save.trainer->set_name(ui->nameLineEdit->text().toStdWString());
-            ui->nameLineEdit->setText(QString::fromStdWString(save.trainer->name()));
-        } catch (const std::exception &e) {
+            const int row = sel_item_table_view->currentIndex().row();
+            const item *before = sel_item_model->item_at(row);
+            if (before == nullptr)
+                return;
+
+            const QString before_name { QString::fromUtf8(before->name()) };
+            const int before_count = before->count();
+            {
+                PKEDIT_TRACE_SCOPE("item_table_model::del_item");
+                sel_item_model->del_item(row);
+            }
+            record_item_step(undo_step::Item_Remove, sel_item_category, row, before_name,
+                             before_count, {}, 0);
+            const bool selected = sel_item_table_view->selectionModel()->hasSelection();
+            ui->editItemPushButton->setEnabled(selected);
+            ui->deleteItemPushButton->setEnabled(selected);
+        } catch (std::exception &e) {
             show_popup_error(e.what());
         }
     });
+    auto debounce_iv = [this](QSpinBox *spin_box, pkstat stat) {
+        connect(spin_box, QOverload<int>::of(&QSpinBox::valueChanged), this, [=, this] {
+            edits->schedule(spin_box, SPINBOX_EDIT_DEBOUNCE_MS,
+                           [=, this] { modify_iv(spin_box, stat); });
+        });
+    };
+    auto debounce_ev = [this](QSpinBox *spin_box, pkstat stat) {
+        connect(spin_box, QOverload<int>::of(&QSpinBox::valueChanged), this, [=, this] {
+            edits->schedule(spin_box, SPINBOX_EDIT_DEBOUNCE_MS,
+                           [=, this] { modify_ev(spin_box, stat); });
+        });
+    };
+    debounce_iv(ui->hpIvSpinBox, pkstat::Hp);
+    debounce_iv(ui->atkIvSpinBox, pkstat::Atk);
+    debounce_iv(ui->defIvSpinBox, pkstat::Def);
+    debounce_iv(ui->speIvSpinBox, pkstat::Spe);
+    debounce_iv(ui->spAtkIvSpinBox, pkstat::Spa);
+    debounce_iv(ui->spDefIvSpinBox, pkstat::Spd);
+    debounce_iv(ui->spDvSpinBox, pkstat::Spe);
+    debounce_ev(ui->hpevSpinBox, pkstat::Hp);
+    debounce_ev(ui->atkEvSpinBox, pkstat::Atk);
+    debounce_ev(ui->defEvSpinBox, pkstat::Def);
+    debounce_ev(ui->speEvSpinBox, pkstat::Spe);
+    debounce_ev(ui->spAtkEvSpinBox, pkstat::Spa);
+    debounce_ev(ui->spDefEvSpinBox, pkstat::Spd);
+    debounce_ev(ui->spcEvSpinBox, pkstat::Spe);
+    connect(ui->levelSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [this] {
+        edits->schedule(ui->levelSpinBox, SPINBOX_EDIT_DEBOUNCE_MS, [this] {
+            try {
+                if (sel_pkmn != nullptr) {
+                    {
+                        PKEDIT_TRACE_SCOPE("pokemon::set_level");
+                        sel_pkmn->set_level(ui->levelSpinBox->value());
+                    }
+                    ui->expSpinBox->blockSignals(true);
+                    ui->expSpinBox->setMinimum(sel_pkmn->min_exp());
+                    ui->expSpinBox->setValue(sel_pkmn->exp());
+                    ui->expSpinBox->setMaximum(sel_pkmn->max_exp());
+                    ui->expSpinBox->blockSignals(false);
+                    schedule_stats_refresh();
+                    update_party_table_row(PKMN_TABLE_LEVEL_COL, PKMN_TABLE_LEVEL_COL);
+                }
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
+    });
+    connect(ui->nameLineEdit, &QLineEdit::textChanged, this, [this] {
+        edits->schedule(ui->nameLineEdit, TEXT_EDIT_DEBOUNCE_MS, [this] {
+            try {
+                {
+                    PKEDIT_TRACE_SCOPE("trainer::set_name");
+                    save.trainer->set_name(ui->nameLineEdit->text().toStdWString());
+                }
+                const QString name { QString::fromStdWString(save.trainer->name()) };
+                if (name != ui->nameLineEdit->text()) {
+                    ui->nameLineEdit->blockSignals(true);
+                    ui->nameLineEdit->setText(name);
+                    ui->nameLineEdit->blockSignals(false);
+                }
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
+    });
     connect(ui->genderComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, [this] {
         try {
+            PKEDIT_TRACE_SCOPE("trainer::set_gender");
             save.trainer->set_gender(ui->genderComboBox->currentIndex());
         } catch (const std::exception &e) {
             show_popup_error(e.what());
         }
     });
     connect(ui->moneySpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [this] {
-        try {
-            save.trainer->set_money(ui->moneySpinBox->value());
-        } catch (const std::exception &e) {
-            show_popup_error(e.what());
-        }
+        edits->schedule(ui->moneySpinBox, SPINBOX_EDIT_DEBOUNCE_MS, [this] {
+            try {
+                PKEDIT_TRACE_SCOPE("trainer::set_money");
+                save.trainer->set_money(ui->moneySpinBox->value());
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
     });
     connect(ui->coinsSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [this] {
-        try {
-            save.trainer->set_coins(ui->coinsSpinBox->value());
-        } catch (const std::exception &e) {
-            show_popup_error(e.what());
-        }
+        edits->schedule(ui->coinsSpinBox, SPINBOX_EDIT_DEBOUNCE_MS, [this] {
+            try {
+                PKEDIT_TRACE_SCOPE("trainer::set_coins");
+                save.trainer->set_coins(ui->coinsSpinBox->value());
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
     });
     connect(ui->speciesComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, [this] {
         if (sel_pkmn == nullptr)
             return;
 
         try {
-            sel_pkmn->set_species(ui->speciesComboBox->currentIndex());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_species");
+                sel_pkmn->set_species(ui->speciesComboBox->currentIndex());
+            }
             set_pkmn_in_editor(sel_pkmn);
+            update_party_table_row();
         } catch (const std::exception &e) {
             show_popup_error(e.what());
         }
     });
     connect(ui->nicknameLineEdit, &QLineEdit::textChanged, this, [this] {
-        if (sel_pkmn == nullptr)
-            return;
-
-        try {
-            if (ui->nicknameLineEdit->text().isEmpty())
+        edits->schedule(ui->nicknameLineEdit, TEXT_EDIT_DEBOUNCE_MS, [this] {
+            if (sel_pkmn == nullptr)
                 return;
-            sel_pkmn->set_nickname(ui->nicknameLineEdit->text().toStdWString());
-            if (sel_pkmn_table_widget == ui->partyTableWidget)
-                update_party_table_widget();
-        } catch (const std::exception &e) {
-            show_popup_error(e.what());
-        }
+
+            try {
+                if (ui->nicknameLineEdit->text().isEmpty())
+                    return;
+                {
+                    PKEDIT_TRACE_SCOPE("pokemon::set_nickname");
+                    sel_pkmn->set_nickname(ui->nicknameLineEdit->text().toStdWString());
+                }
+                update_party_table_row(PKMN_TABLE_NICKNAME_COL, PKMN_TABLE_NICKNAME_COL);
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
     });
     connect(ui->expSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), this, [this] {
         if (sel_pkmn == nullptr)
             return;
 
         try {
+            PKEDIT_TRACE_SCOPE("pokemon::set_exp");
             sel_pkmn->set_exp(ui->expSpinBox->value());
         } catch (const std::exception &e) {
             show_popup_error(e.what());
@@ -361,6 +616,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
+            PKEDIT_TRACE_SCOPE("pokemon::set_friendship");
             sel_pkmn->set_friendship(ui->friendshipSpinBox->value());
         } catch (const std::exception &e) {
             show_popup_error(e.what());
@@ -389,7 +645,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
                             gender = pokemon_gender::GENDERLESS;
                             break;
                     }
-                    sel_pkmn->set_gender(gender);
+                    {
+                        PKEDIT_TRACE_SCOPE("pokemon::set_gender");
+                        sel_pkmn->set_gender(gender);
+                    }
                     ui->shinyCheckBox->blockSignals(true);
                     ui->natureComboBox->blockSignals(true);
                     ui->shinyCheckBox->setChecked(sel_pkmn->is_shiny());
@@ -397,8 +656,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
                     ui->shinyCheckBox->blockSignals(false);
                     ui->natureComboBox->blockSignals(false);
                     update_pid_on_ui(sel_pkmn);
-                    if (sel_pkmn_table_widget == ui->partyTableWidget)
-                        update_party_table_widget();
+                    update_party_table_row(PKMN_TABLE_GENDER_COL, PKMN_TABLE_SHINY_COL);
                 } catch (const std::exception &e) {
                     show_popup_error(e.what());
                 }
@@ -411,7 +669,11 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             if (ui->natureComboBox->currentIndex() == 0)
                 throw std::runtime_error("Invalid nature");
 
-            sel_pkmn->set_nature(static_cast<pkmn_nature>(ui->natureComboBox->currentIndex() - 1));
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_nature");
+                sel_pkmn->set_nature(
+                    static_cast<pkmn_nature>(ui->natureComboBox->currentIndex() - 1));
+            }
             ui->pkmnGenderComboBox->blockSignals(true);
             ui->shinyCheckBox->blockSignals(true);
             set_pkmn_gender_combo_box(sel_pkmn);
@@ -419,7 +681,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             ui->pkmnGenderComboBox->blockSignals(false);
             ui->shinyCheckBox->blockSignals(false);
             update_pid_on_ui(sel_pkmn);
-            update_stats_on_ui(sel_pkmn);
+            schedule_stats_refresh();
         } catch (const std::exception &e) {
             show_popup_error(e.what());
         }
@@ -451,7 +713,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
                     break;
             }
 
-            sel_pkmn->set_status(status);
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_status");
+                sel_pkmn->set_status(status);
+            }
         } catch (const std::exception &e) {
             show_popup_error(e.what());
         }
@@ -462,7 +727,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_ability(ui->abilityComboBox->currentIndex());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_ability");
+                sel_pkmn->set_ability(ui->abilityComboBox->currentIndex());
+            }
             update_pid_on_ui(sel_pkmn);
         } catch (const std::exception &e) {
             show_popup_error(e.what());
@@ -474,7 +742,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_infected(ui->infectedCheckBox->isChecked());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_infected");
+                sel_pkmn->set_infected(ui->infectedCheckBox->isChecked());
+            }
             ui->curedCheckBox->blockSignals(true);
             ui->curedCheckBox->setChecked(sel_pkmn->is_cured());
             ui->curedCheckBox->blockSignals(false);
@@ -488,7 +759,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_cured(ui->curedCheckBox->isChecked());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_cured");
+                sel_pkmn->set_cured(ui->curedCheckBox->isChecked());
+            }
             ui->infectedCheckBox->blockSignals(true);
             ui->infectedCheckBox->setChecked(sel_pkmn->is_infected());
             ui->infectedCheckBox->blockSignals(false);
@@ -503,8 +777,11 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
                     return;
 
                 try {
-                    sel_pkmn->set_held_item(save.trainer->item_idx_from_name(
-                        ui->heldItemComboBox->currentText().toStdString().c_str()));
+                    // Rows of the items model are libpkedit item indices.
+                    {
+                        PKEDIT_TRACE_SCOPE("pokemon::set_held_item");
+                        sel_pkmn->set_held_item(ui->heldItemComboBox->currentIndex());
+                    }
                 } catch (const std::exception &e) {
                     show_popup_error(e.what());
                 }
@@ -515,7 +792,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_shiny(ui->shinyCheckBox->isChecked());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_shiny");
+                sel_pkmn->set_shiny(ui->shinyCheckBox->isChecked());
+            }
             ui->natureComboBox->blockSignals(true);
             ui->pkmnGenderComboBox->blockSignals(true);
             ui->natureComboBox->setCurrentIndex(sel_pkmn->nature() + 1);
@@ -523,8 +803,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             ui->pkmnGenderComboBox->blockSignals(false);
             ui->natureComboBox->blockSignals(false);
             update_pid_on_ui(sel_pkmn);
-            if (sel_pkmn_table_widget == ui->partyTableWidget)
-                update_party_table_widget();
+            update_party_table_row(PKMN_TABLE_GENDER_COL, PKMN_TABLE_SHINY_COL);
         } catch (const std::exception &e) {
             ui->shinyCheckBox->setChecked(ui->shinyCheckBox->isChecked());
             show_popup_error(e.what());
@@ -536,9 +815,11 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_egg(ui->eggCheckBox->isChecked());
-            if (sel_pkmn_table_widget == ui->partyTableWidget)
-                update_party_table_widget();
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_egg");
+                sel_pkmn->set_egg(ui->eggCheckBox->isChecked());
+            }
+            update_party_table_row();
         } catch (const std::exception &e) {
             ui->eggCheckBox->setChecked(ui->eggCheckBox->isChecked());
             show_popup_error(e.what());
@@ -551,6 +832,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
                     return;
 
                 try {
+                    PKEDIT_TRACE_SCOPE("pokemon::set_origin_game");
                     sel_pkmn->set_origin_game(ui->originGameComboBox->currentIndex());
                 } catch (const std::exception &e) {
                     ui->originGameComboBox->setCurrentIndex(sel_pkmn->game_of_origin());
@@ -564,6 +846,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
                     return;
 
                 try {
+                    PKEDIT_TRACE_SCOPE("pokemon::set_location_met");
                     sel_pkmn->set_location_met(
                         ui->locationComboBox->currentText().toStdString().c_str());
                 } catch (const std::exception &e) {
@@ -577,6 +860,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
                     return;
 
                 try {
+                    PKEDIT_TRACE_SCOPE("pokemon::set_pokeball");
                     sel_pkmn->set_pokeball(ui->pokeballComboBox->currentIndex());
                 } catch (const std::exception &e) {
                     show_popup_error(e.what());
@@ -588,6 +872,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
+            PKEDIT_TRACE_SCOPE("pokemon::set_level_met");
             sel_pkmn->set_level_met(ui->levelMetSpinBox->value());
         } catch (const std::exception &e) {
             ui->levelMetSpinBox->setValue(sel_pkmn->level_met());
@@ -601,6 +886,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
                     return;
 
                 try {
+                    PKEDIT_TRACE_SCOPE("pokemon::set_fateful_encounter");
                     sel_pkmn->set_fateful_encounter(ui->fatefulEncounterCheckBox->isChecked());
                 } catch (const std::exception &e) {
                     ui->fatefulEncounterCheckBox->setChecked(sel_pkmn->fateful_encounter());
@@ -613,7 +899,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_move1(ui->m1ComboBox->currentIndex());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_move1");
+                sel_pkmn->set_move1(ui->m1ComboBox->currentIndex());
+            }
             ui->pp1SpinBox->blockSignals(true);
             ui->pp1SpinBox->setMaximum(sel_pkmn->move1_max_pp());
             ui->pp1SpinBox->setValue(sel_pkmn->pp1());
@@ -630,7 +919,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_move2(ui->m2ComboBox->currentIndex());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_move2");
+                sel_pkmn->set_move2(ui->m2ComboBox->currentIndex());
+            }
             ui->pp2SpinBox->blockSignals(true);
             ui->pp2SpinBox->setMaximum(sel_pkmn->move2_max_pp());
             ui->pp2SpinBox->setValue(sel_pkmn->pp2());
@@ -647,7 +939,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_move3(ui->m3ComboBox->currentIndex());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_move3");
+                sel_pkmn->set_move3(ui->m3ComboBox->currentIndex());
+            }
             ui->pp3SpinBox->blockSignals(true);
             ui->pp3SpinBox->setMaximum(sel_pkmn->move3_max_pp());
             ui->pp3SpinBox->setValue(sel_pkmn->pp3());
@@ -664,7 +959,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_move4(ui->m4ComboBox->currentIndex());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_move4");
+                sel_pkmn->set_move4(ui->m4ComboBox->currentIndex());
+            }
             ui->pp4SpinBox->blockSignals(true);
             ui->pp4SpinBox->setMaximum(sel_pkmn->move4_max_pp());
             ui->pp4SpinBox->setValue(sel_pkmn->pp4());
@@ -681,6 +979,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
+            PKEDIT_TRACE_SCOPE("pokemon::set_move1_pp");
             sel_pkmn->set_move1_pp(ui->pp1SpinBox->value());
         } catch (const std::exception &e) {
             show_popup_error(e.what());
@@ -692,6 +991,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
+            PKEDIT_TRACE_SCOPE("pokemon::set_move2_pp");
             sel_pkmn->set_move2_pp(ui->pp2SpinBox->value());
         } catch (const std::exception &e) {
             show_popup_error(e.what());
@@ -703,6 +1003,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
+            PKEDIT_TRACE_SCOPE("pokemon::set_move3_pp");
             sel_pkmn->set_move3_pp(ui->pp3SpinBox->value());
         } catch (const std::exception &e) {
             show_popup_error(e.what());
@@ -714,6 +1015,7 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
+            PKEDIT_TRACE_SCOPE("pokemon::set_move4_pp");
             sel_pkmn->set_move4_pp(ui->pp4SpinBox->value());
         } catch (const std::exception &e) {
             show_popup_error(e.what());
@@ -725,7 +1027,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_move1_bonus(ui->pp1BonusSpinBox->value());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_move1_bonus");
+                sel_pkmn->set_move1_bonus(ui->pp1BonusSpinBox->value());
+            }
             ui->pp1SpinBox->blockSignals(true);
             ui->pp1SpinBox->setMaximum(sel_pkmn->move1_max_pp());
             ui->pp1SpinBox->setValue(sel_pkmn->pp1());
@@ -741,7 +1046,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_move2_bonus(ui->pp2BonusSpinBox->value());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_move2_bonus");
+                sel_pkmn->set_move2_bonus(ui->pp2BonusSpinBox->value());
+            }
             ui->pp2SpinBox->blockSignals(true);
             ui->pp2SpinBox->setMaximum(sel_pkmn->move2_max_pp());
             ui->pp2SpinBox->setValue(sel_pkmn->pp2());
@@ -757,7 +1065,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_move3_bonus(ui->pp3BonusSpinBox->value());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_move3_bonus");
+                sel_pkmn->set_move3_bonus(ui->pp3BonusSpinBox->value());
+            }
             ui->pp3SpinBox->blockSignals(true);
             ui->pp3SpinBox->setMaximum(sel_pkmn->move3_max_pp());
             ui->pp3SpinBox->setValue(sel_pkmn->pp3());
@@ -773,7 +1084,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             return;
 
         try {
-            sel_pkmn->set_move4_bonus(ui->pp4BonusSpinBox->value());
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::set_move4_bonus");
+                sel_pkmn->set_move4_bonus(ui->pp4BonusSpinBox->value());
+            }
             ui->pp4SpinBox->blockSignals(true);
             ui->pp4SpinBox->setMaximum(sel_pkmn->move4_max_pp());
             ui->pp4SpinBox->setValue(sel_pkmn->pp4());
@@ -785,51 +1099,66 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
     });
 
     connect(ui->otPidLineEdit, &QLineEdit::textChanged, this, [this] {
-        if (sel_pkmn == nullptr)
-            return;
-
-        try {
-            if (ui->otPidLineEdit->text().isEmpty())
+        edits->schedule(ui->otPidLineEdit, TEXT_EDIT_DEBOUNCE_MS, [this] {
+            if (sel_pkmn == nullptr)
                 return;
 
-            sel_pkmn->set_ot_pid(std::stoi(ui->otPidLineEdit->text().toStdString()));
-            ui->shinyCheckBox->blockSignals(true);
-            ui->shinyCheckBox->setChecked(sel_pkmn->is_shiny());
-            ui->shinyCheckBox->blockSignals(false);
-        } catch (const std::exception &e) {
-            show_popup_error(e.what());
-        }
+            try {
+                if (ui->otPidLineEdit->text().isEmpty())
+                    return;
+
+                {
+                    PKEDIT_TRACE_SCOPE("pokemon::set_ot_pid");
+                    sel_pkmn->set_ot_pid(std::stoi(ui->otPidLineEdit->text().toStdString()));
+                }
+                ui->shinyCheckBox->blockSignals(true);
+                ui->shinyCheckBox->setChecked(sel_pkmn->is_shiny());
+                ui->shinyCheckBox->blockSignals(false);
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
     });
 
     connect(ui->otSidLineEdit, &QLineEdit::textChanged, this, [this] {
-        if (sel_pkmn == nullptr)
-            return;
-
-        try {
-            if (ui->otSidLineEdit->text().isEmpty())
+        edits->schedule(ui->otSidLineEdit, TEXT_EDIT_DEBOUNCE_MS, [this] {
+            if (sel_pkmn == nullptr)
                 return;
 
-            sel_pkmn->set_ot_sid(std::stoi(ui->otSidLineEdit->text().toStdString()));
-            ui->shinyCheckBox->blockSignals(true);
-            ui->shinyCheckBox->setChecked(sel_pkmn->is_shiny());
-            ui->shinyCheckBox->blockSignals(false);
-        } catch (const std::exception &e) {
-            show_popup_error(e.what());
-        }
+            try {
+                if (ui->otSidLineEdit->text().isEmpty())
+                    return;
+
+                {
+                    PKEDIT_TRACE_SCOPE("pokemon::set_ot_sid");
+                    sel_pkmn->set_ot_sid(std::stoi(ui->otSidLineEdit->text().toStdString()));
+                }
+                ui->shinyCheckBox->blockSignals(true);
+                ui->shinyCheckBox->setChecked(sel_pkmn->is_shiny());
+                ui->shinyCheckBox->blockSignals(false);
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
     });
 
     connect(ui->otNameLineEdit, &QLineEdit::textChanged, this, [this] {
-        if (sel_pkmn == nullptr)
-            return;
-
-        try {
-            if (ui->otNameLineEdit->text().isEmpty())
+        edits->schedule(ui->otNameLineEdit, TEXT_EDIT_DEBOUNCE_MS, [this] {
+            if (sel_pkmn == nullptr)
                 return;
 
-            sel_pkmn->set_ot_name(ui->otNameLineEdit->text().toStdWString());
-        } catch (const std::exception &e) {
-            show_popup_error(e.what());
-        }
+            try {
+                if (ui->otNameLineEdit->text().isEmpty())
+                    return;
+
+                {
+                    PKEDIT_TRACE_SCOPE("pokemon::set_ot_name");
+                    sel_pkmn->set_ot_name(ui->otNameLineEdit->text().toStdWString());
+                }
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
     });
     connect(ui->otGenderComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this,
             [this] {
@@ -837,30 +1166,43 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
                     return;
 
                 try {
+                    PKEDIT_TRACE_SCOPE("pokemon::set_ot_gender");
                     sel_pkmn->set_ot_gender(ui->otGenderComboBox->currentIndex());
                 } catch (const std::exception &e) {
                     show_popup_error(e.what());
                 }
             });
     connect(ui->publicIdLineEdit, &QLineEdit::textChanged, this, [this] {
-        try {
-            if (ui->publicIdLineEdit->text().isEmpty())
-                return;
+        edits->schedule(ui->publicIdLineEdit, TEXT_EDIT_DEBOUNCE_MS, [this] {
+            try {
+                if (ui->publicIdLineEdit->text().isEmpty())
+                    return;
 
-            save.trainer->set_public_id(std::stoi(ui->publicIdLineEdit->text().toStdString()));
-        } catch (const std::exception &e) {
-            show_popup_error(e.what());
-        }
+                {
+                    PKEDIT_TRACE_SCOPE("trainer::set_public_id");
+                    save.trainer->set_public_id(
+                        std::stoi(ui->publicIdLineEdit->text().toStdString()));
+                }
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
     });
     connect(ui->secretIdLineEdit, &QLineEdit::textChanged, this, [this] {
-        try {
-            if (ui->secretIdLineEdit->text().isEmpty())
-                return;
+        edits->schedule(ui->secretIdLineEdit, TEXT_EDIT_DEBOUNCE_MS, [this] {
+            try {
+                if (ui->secretIdLineEdit->text().isEmpty())
+                    return;
 
-            save.trainer->set_secret_id(std::stoi(ui->secretIdLineEdit->text().toStdString()));
-        } catch (const std::exception &e) {
-            show_popup_error(e.what());
-        }
+                {
+                    PKEDIT_TRACE_SCOPE("trainer::set_secret_id");
+                    save.trainer->set_secret_id(
+                        std::stoi(ui->secretIdLineEdit->text().toStdString()));
+                }
+            } catch (const std::exception &e) {
+                show_popup_error(e.what());
+            }
+        });
     });
 
     QIntValidator *pid_sid_validator = new QIntValidator(this);
@@ -878,122 +1220,1288 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
             if (!sel_pkmn->has_trade_evolution())
                 throw std::runtime_error("Pokemon does not have a trade evolution");
 
-            sel_pkmn->simulate_trade_evolution();
+            {
+                PKEDIT_TRACE_SCOPE("pokemon::simulate_trade_evolution");
+                sel_pkmn->simulate_trade_evolution();
+            }
             ui->speciesComboBox->blockSignals(true);
             ui->nicknameLineEdit->blockSignals(true);
             ui->speciesComboBox->setCurrentIndex(sel_pkmn->species());
             ui->nicknameLineEdit->setText(QString::fromStdWString(sel_pkmn->nickname()));
             ui->nicknameLineEdit->blockSignals(false);
             ui->speciesComboBox->blockSignals(false);
-            update_stats_on_ui(sel_pkmn);
+            schedule_stats_refresh();
             ui->pkmnSimulateTradePushButton->setEnabled(false);
+            update_party_table_row();
+            record_field_edit(ui->speciesComboBox, false);
         } catch (const std::exception &e) {
             show_popup_error(e.what());
         }
     });
-}
 
-MainWindow::~MainWindow() noexcept { delete ui; }
+    track_undo_fields();
+}
 
-void MainWindow::open_file()
+MainWindow::~MainWindow() noexcept
 {
-    QString filename { QFileDialog::getOpenFileName(nullptr, "Open File", "", QFILEDIALOG_FILTER) };
-
-    if (filename.isEmpty())
-        return;
-
-    try {
-        if (save_loaded) {
-            reset_ui();
-            delete save.trainer;
-            save_loaded = false;
-        }
-
-        save = read_pkmn_save_file(filename.toStdString().c_str());
-        block_all_signals(true);
-        save_loaded = true;
-        ui->saveLoadedLabel->setText(
-            (std::string { "Detected Save: Pokemon " } + save.game_name).data());
-        ui->saveLoadedLabel->setStyleSheet("font: 16pt \"Sans Serif\"; color: green;");
-        ui->nameLineEdit->setEnabled(true);
-        ui->genderComboBox->setEnabled(true);
-        ui->moneySpinBox->setEnabled(true);
-        ui->coinsSpinBox->setEnabled(true);
-        ui->partyTableWidget->setEnabled(true);
-        ui->addItemPushButton->setEnabled(true);
-        ui->nameLineEdit->setText(QString::fromStdWString(save.trainer->name()));
-        ui->genderComboBox->setCurrentIndex(save.trainer->is_female());
-
-        ui->nameLineEdit->setMaxLength(save.trainer->name_length());
-        ui->coinsSpinBox->setMaximum(save.trainer->max_coins());
-        ui->moneySpinBox->setMaximum(save.trainer->max_money());
-
-        ui->moneySpinBox->setValue(save.trainer->money());
-        ui->coinsSpinBox->setValue(save.trainer->coins());
-        ui->publicIdLineEdit->setText(
-            QString::fromStdString(std::to_string(save.trainer->public_id())));
-        ui->secretIdLineEdit->setText(
-            QString::fromStdString(std::to_string(save.trainer->secret_id())));
-        ui->publicIdLineEdit->setEnabled(true);
-        ui->secretIdLineEdit->setEnabled(true);
-
-        const trainer_time_played tm { save.trainer->time_played() };
-        ui->timePlayedLineEdit->setText(QString::fromStdString(std::to_string(tm.hours) + ":" +
-                                                               std::to_string(tm.minutes) + ":" +
-                                                               std::to_string(tm.seconds)));
+    // A worker may still be writing to `save`.
+    pending_io.waitForFinished();
+    delete ui;
+}
 
-        update_party_table_widget();
+void MainWindow::set_io_in_progress(bool busy, const QString &message)
+{
+    io_in_progress = busy;
+    // The worker holds the save and the writer, so everything that reads or
+    // edits either waits until it is done. Handlers reached some other way,
+    // such as from a dialog, check io_in_progress themselves.
+    centralWidget()->setEnabled(!busy);
+    for (QAction *action :
+         { ui->actionOpen_File, ui->actionSave_File, ui->actionSave_As, ui->actionCompare_With,
+           ui->actionAllow_Potentially_Illegal_Modifications, ui->actionFind_Pid,
+           ui->actionAudit_Seeds })
+        action->setEnabled(!busy);
+    for (QAction *action : ui->menuEdit_Party->actions())
+        action->setEnabled(!busy);
+    legality->setEnabled(!busy);
+    update_undo_actions();
+    io_progress_bar->setVisible(busy);
+    if (busy)
+        statusBar()->showMessage(message);
+    else
+        statusBar()->showMessage(message, 5000);
+}
 
-        auto add_items = [](const std::vector<std::shared_ptr<item>> &items, QTableWidget *table) {
-            for (usize i = 0; i < items.size(); ++i) {
-                QTableWidgetItem *name = new QTableWidgetItem(items[i]->name());
-                QTableWidgetItem *quantity =
-                    new QTableWidgetItem(std::to_string(items[i]->count()).c_str());
-                table->insertRow(i);
-                table->setItem(i, ITEM_TABLE_NAME_COL, name);
-                table->setItem(i, ITEM_TABLE_QUANTITY_COL, quantity);
-            }
-        };
+void MainWindow::remove_party_pkmn(int row)
+{
+    edits->flush();
+    const bool editing_row = sel_pkmn_table_view == ui->partyTableView;
+    if (editing_row && sel_pkmn == party_model->pokemon_at(row)) {
+        set_pkmn_in_editor(nullptr);
+        block_pkmn_editor_signals(false);
+        sel_pkmn = nullptr;
+    }
 
-        add_items(save.trainer->get_pocket_items(), ui->itemsTableWidget);
-        add_items(save.trainer->get_ball_items(), ui->ballsTableWidget);
-        add_items(save.trainer->get_berry_case(), ui->berriesTableWidget);
-        add_items(save.trainer->get_tm_case(), ui->tmsTableWidget);
-        add_items(save.trainer->get_key_items(), ui->keyItemsTableWidget);
-        add_items(save.trainer->get_pc_items(), ui->pcItemsTableWidget);
+    {
+        PKEDIT_TRACE_SCOPE("trainer::remove_pkmn_from_party");
+        party_model->remove_pkmn(row);
+    }
+    log_edit({ recovery_record::Party_Remove, 0, 0, row });
+    // libpkedit can't put a removed Pokemon back, so its own steps go; later
+    // slots shift up, and so do their steps.
+    journal.remove_party_slot(row);
+    update_undo_actions();
+    if (editing_row && sel_pkmn != nullptr && sel_pkmn_table_row > row)
+        --sel_pkmn_table_row;
+}
 
-        ui->itemsTabWidget->setEnabled(true);
-        ui->itemsTableWidget->setEnabled(true);
-        ui->ballsTableWidget->setEnabled(true);
-        ui->berriesTableWidget->setEnabled(true);
-        ui->tmsTableWidget->setEnabled(true);
-        ui->keyItemsTableWidget->setEnabled(true);
-        ui->pcItemsTableWidget->setEnabled(true);
+void MainWindow::bulk_edit_party(bulk_edit_op op, int value)
+{
+    if (!save_loaded || io_in_progress)
+        return;
 
-        add_item_names_to_combo_box(ui->itemNameComboBox, sel_item_category);
+    // The selected rows, or the whole party if none are selected.
+    u32 rows = 0;
+    for (const QModelIndex &i : ui->partyTableView->selectionModel()->selectedRows())
+        rows |= 1u << i.row();
+    if (rows == 0)
+        rows = (1u << party_model->rowCount()) - 1;
 
-        ui->itemNameComboBox->setEnabled(true);
-        ui->quantitySpinBox->setEnabled(true);
+    try {
+        const bulk_edit_result result { apply_party_bulk_edit(op, rows, value) };
+        statusBar()->showMessage(QString("%1: %2 Pokemon changed in %3 ms")
+                                     .arg(bulk_edit_name(op))
+                                     .arg(result.changed)
+                                     .arg(result.ms, 0, 'f', 2),
+                                 5000);
+        if (result.errors.empty())
+            return;
 
-        block_all_signals(false);
-    } catch (std::exception &e) {
+        QString message { QString("%1 failed for %2 Pokemon:")
+                              .arg(bulk_edit_name(op))
+                              .arg(result.errors.size()) };
+        for (const auto &[row, reason] : result.errors)
+            message += QString("\n%1: %2")
+                           .arg(QString::fromStdWString(
+                               party_model->pokemon_at(static_cast<int>(row))->nickname()))
+                           .arg(QString::fromStdString(reason));
+        show_popup_error(message.toStdString().c_str());
+    } catch (const std::exception &e) {
         show_popup_error(e.what());
-        block_all_signals(false);
     }
 }
 
-void MainWindow::add_pkmn_to_table_widget(QTableWidget *table, const pokemon *pkmn, int index) const
+bulk_edit_result MainWindow::apply_party_bulk_edit(bulk_edit_op op, u32 rows, int value)
 {
-    QTableWidgetItem *nickname = new QTableWidgetItem(QString::fromStdWString(pkmn->nickname()));
-    QTableWidgetItem *gender = new QTableWidgetItem(pkmn->gender_name());
-    QTableWidgetItem *level = new QTableWidgetItem(std::to_string(pkmn->level()).c_str());
-    QTableWidgetItem *shiny = new QTableWidgetItem(pkmn->is_shiny() ? "Yes" : "No");
-    QTableWidgetItem *egg = new QTableWidgetItem(pkmn->is_egg() ? "Yes" : "No");
-    table->setItem(index, PKMN_TABLE_NICKNAME_COL, nickname);
-    table->setItem(index, PKMN_TABLE_GENDER_COL, gender);
-    table->setItem(index, PKMN_TABLE_LEVEL_COL, level);
-    table->setItem(index, PKMN_TABLE_SHINY_COL, shiny);
-    table->setItem(index, PKMN_TABLE_EGG_COL, egg);
+    PKEDIT_TRACE_SCOPE("MainWindow::apply_party_bulk_edit");
+    edits->flush();
+    std::vector<pokemon *> targets;
+    std::vector<int> target_rows;
+    for (int row = 0; row < party_model->rowCount(); ++row) {
+        pokemon *pkmn = party_model->pokemon_at(row);
+        if ((rows & (1u << row)) != 0 && pkmn != nullptr) {
+            targets.push_back(pkmn);
+            target_rows.push_back(row);
+        }
+    }
+
+    // The fields of each target, read from the Pokemon before and after,
+    // become one undo step. Replayed edits aren't journaled.
+    const bool journaled = !replaying_undo;
+    std::vector<std::vector<std::pair<QWidget *, QVariant>>> before_values;
+    if (journaled)
+        for (const pokemon *pkmn : targets)
+            before_values.push_back(bulk_edit_values(pkmn));
+
+    bulk_edit_result result { apply_bulk_edit(targets, op, value,
+                                              opt.allow_illegal_modifications) };
+    for (auto &error : result.errors)
+        error.first = target_rows[error.first];
+    if (journaled)
+        record_bulk_edit_steps(target_rows, before_values);
+
+    // One redraw for the whole batch rather than one per Pokemon and field.
+    party_model->refresh_all();
+    if (sel_pkmn != nullptr && std::find(targets.begin(), targets.end(), sel_pkmn) != targets.end())
+        set_pkmn_in_editor(sel_pkmn);
+
+    log_edit({ recovery_record::Bulk_Edit, static_cast<u8>(op), 0, static_cast<int>(rows), value });
+    update_undo_actions();
+    return result;
+}
+
+std::vector<std::pair<QWidget *, QVariant>> MainWindow::bulk_edit_values(const pokemon *pkmn)
+{
+    // In the order they are applied back: the species before the nickname it
+    // may rename, and the level before the experience it resets.
+    std::vector<std::pair<QWidget *, QVariant>> values {
+        { ui->speciesComboBox, pkmn->species() },
+        { ui->nicknameLineEdit, QString::fromStdWString(pkmn->nickname()) },
+    };
+    if (pkmn->compat_has_held_item() && pkmn->held_item() != nullptr) {
+        const QStringListModel *items = combo_models.items(pkmn, save);
+        const QString name { QString::fromUtf8(pkmn->held_item()->name()) };
+        values.push_back(
+            { ui->heldItemComboBox, pkmn->has_item() ? combo_models.row_of(items, name) : 0 });
+    }
+    values.push_back({ ui->levelSpinBox, pkmn->level() });
+    values.push_back({ ui->expSpinBox, static_cast<int>(pkmn->exp()) });
+
+    // The IVs and EVs as the stats page shows them, -1 where there is none.
+    const std::array<QSpinBox *, stat_view::Count - stat_view::Hp_Iv> stat_spin_boxes {
+        ui->hpIvSpinBox,   ui->atkIvSpinBox,   ui->defIvSpinBox,   ui->speIvSpinBox,
+        ui->spAtkIvSpinBox, ui->spDefIvSpinBox, ui->spDvSpinBox,   ui->hpevSpinBox,
+        ui->atkEvSpinBox,  ui->defEvSpinBox,   ui->speEvSpinBox,   ui->spAtkEvSpinBox,
+        ui->spDefEvSpinBox, ui->spcEvSpinBox,
+    };
+    const stat_view stats { make_stat_view(pkmn) };
+    for (usize i = 0; i < stat_spin_boxes.size(); ++i)
+        if (const int stat = stats.values[stat_view::Hp_Iv + i]; stat >= 0)
+            values.push_back({ stat_spin_boxes[i], stat });
+
+    values.push_back({ ui->pp1SpinBox, pkmn->pp1() });
+    values.push_back({ ui->pp2SpinBox, pkmn->pp2() });
+    values.push_back({ ui->pp3SpinBox, pkmn->pp3() });
+    values.push_back({ ui->pp4SpinBox, pkmn->pp4() });
+    values.push_back({ ui->statusComboBox, status_combo_index(pkmn->status()) });
+    return values;
+}
+
+void MainWindow::record_bulk_edit_steps(
+    const std::vector<int> &rows,
+    const std::vector<std::vector<std::pair<QWidget *, QVariant>>> &before_values)
+{
+    journal.begin_group();
+    for (usize i = 0; i < rows.size(); ++i) {
+        const std::vector<std::pair<QWidget *, QVariant>> &before = before_values[i];
+        for (const auto &[field, after] : bulk_edit_values(party_model->pokemon_at(rows[i]))) {
+            const auto it = std::find_if(before.begin(), before.end(),
+                                         [field](const auto &entry) {
+                                             return entry.first == field;
+                                         });
+            if (it == before.end() || it->second == after)
+                continue;
+
+            undo_step step {};
+            step.field = field;
+            step.target = rows[i];
+            if (qobject_cast<QLineEdit *>(field) != nullptr) {
+                step.type = undo_step::Text_Field;
+                journal.record(step, it->second.toString(), after.toString());
+            } else {
+                step.before = it->second.toInt();
+                step.after = after.toInt();
+                journal.record(step);
+            }
+        }
+    }
+    journal.end_group();
+}
+
+void MainWindow::track_undo_fields()
+{
+    trainer_fields = {
+        ui->nameLineEdit, ui->genderComboBox,   ui->moneySpinBox,
+        ui->coinsSpinBox, ui->publicIdLineEdit, ui->secretIdLineEdit,
+    };
+    pkmn_fields = {
+        ui->speciesComboBox,    ui->nicknameLineEdit,
+        ui->levelSpinBox,       ui->expSpinBox,
+        ui->friendshipSpinBox,  ui->pkmnGenderComboBox,
+        ui->natureComboBox,     ui->statusComboBox,
+        ui->abilityComboBox,    ui->infectedCheckBox,
+        ui->curedCheckBox,      ui->heldItemComboBox,
+        ui->shinyCheckBox,      ui->eggCheckBox,
+        ui->originGameComboBox, ui->locationComboBox,
+        ui->pokeballComboBox,   ui->levelMetSpinBox,
+        ui->fatefulEncounterCheckBox,
+        ui->m1ComboBox,         ui->m2ComboBox,
+        ui->m3ComboBox,         ui->m4ComboBox,
+        ui->pp1SpinBox,         ui->pp2SpinBox,
+        ui->pp3SpinBox,         ui->pp4SpinBox,
+        ui->pp1BonusSpinBox,    ui->pp2BonusSpinBox,
+        ui->pp3BonusSpinBox,    ui->pp4BonusSpinBox,
+        ui->otPidLineEdit,      ui->otSidLineEdit,
+        ui->otNameLineEdit,     ui->otGenderComboBox,
+        ui->hpIvSpinBox,        ui->atkIvSpinBox,
+        ui->defIvSpinBox,       ui->speIvSpinBox,
+        ui->spAtkIvSpinBox,     ui->spDefIvSpinBox,
+        ui->spDvSpinBox,        ui->hpevSpinBox,
+        ui->atkEvSpinBox,       ui->defEvSpinBox,
+        ui->speEvSpinBox,       ui->spAtkEvSpinBox,
+        ui->spDefEvSpinBox,     ui->spcEvSpinBox,
+    };
+
+    // Connected after the editor's own handlers, so these run once the edit
+    // has been applied (or, for debounced fields, scheduled).
+    auto track = [this](QWidget *field, bool trainer_field) {
+        auto record = [=, this] { record_field_edit(field, trainer_field); };
+        if (auto *spin_box = qobject_cast<QSpinBox *>(field))
+            connect(spin_box, QOverload<int>::of(&QSpinBox::valueChanged), this, record);
+        else if (auto *combo_box = qobject_cast<QComboBox *>(field))
+            connect(combo_box, QOverload<int>::of(&QComboBox::currentIndexChanged), this, record);
+        else if (auto *check_box = qobject_cast<QCheckBox *>(field))
+            connect(check_box, QOverload<int>::of(&QCheckBox::stateChanged), this, record);
+        else if (auto *line_edit = qobject_cast<QLineEdit *>(field))
+            connect(line_edit, &QLineEdit::textChanged, this, record);
+    };
+    for (QWidget *field : trainer_fields)
+        track(field, true);
+    for (QWidget *field : pkmn_fields)
+        track(field, false);
+
+    // Commits update dependent widgets with their signals blocked (e.g. the
+    // level sets the experience), which become the new "before" values.
+    connect(edits, &edit_coalescer::committed, this, [this] { snapshot_field_values(); });
+    connect(ui->actionUndo, &QAction::triggered, this, [this] { undo_or_redo(false); });
+    connect(ui->actionRedo, &QAction::triggered, this, [this] { undo_or_redo(true); });
+
+    connect(ui->actionMax_Ivs, &QAction::triggered, this,
+            [this] { bulk_edit_party(bulk_edit_op::Max_Ivs); });
+    connect(ui->actionReset_Evs, &QAction::triggered, this,
+            [this] { bulk_edit_party(bulk_edit_op::Reset_Evs); });
+    connect(ui->actionRestore_Pp, &QAction::triggered, this,
+            [this] { bulk_edit_party(bulk_edit_op::Restore_Pp); });
+    connect(ui->actionHeal_Status, &QAction::triggered, this,
+            [this] { bulk_edit_party(bulk_edit_op::Heal_Status); });
+    connect(ui->actionTrade_Evolve, &QAction::triggered, this,
+            [this] { bulk_edit_party(bulk_edit_op::Trade_Evolve); });
+    connect(ui->actionFind_Pid, &QAction::triggered, this, [this] { open_pid_search(); });
+    connect(ui->actionAudit_Seeds, &QAction::triggered, this, [this] { audit_rng_seeds(); });
+    connect(ui->actionSet_Level, &QAction::triggered, this, [this] {
+        bool ok = false;
+        const int level = QInputDialog::getInt(this, "Set Level", "Level:", 50, 1, 100, 1, &ok);
+        if (ok)
+            bulk_edit_party(bulk_edit_op::Set_Level, level);
+    });
+}
+
+void MainWindow::snapshot_field_values()
+{
+    for (QWidget *field : trainer_fields)
+        field_values[field] = field_value(field);
+    for (QWidget *field : pkmn_fields)
+        field_values[field] = field_value(field);
+    shown_pid = sel_pkmn != nullptr ? sel_pkmn->personality_value() : 0;
+}
+
+std::array<QWidget *, 4> MainWindow::pid_trait_fields() const
+{
+    return { ui->pkmnGenderComboBox, ui->natureComboBox, ui->shinyCheckBox,
+             ui->abilityComboBox };
+}
+
+void MainWindow::record_field_edit(QWidget *field, bool trainer_field)
+{
+    if (replaying_undo || !save_loaded)
+        return;
+
+    const QVariant before { field_values.value(field) };
+    const QVariant after { field_value(field) };
+    const bool editing_party = sel_pkmn != nullptr && sel_pkmn_table_view == ui->partyTableView;
+    if (before.isValid() && before != after && (trainer_field || editing_party)) {
+        undo_step step {};
+        step.field = field;
+        step.target = trainer_field ? undo_journal::TRAINER : static_cast<int>(sel_pkmn_table_row);
+
+        // Setting any of these re-rolls the PID, which may change the others,
+        // so the PID and all of them are kept together.
+        const std::array<QWidget *, 4> traits { pid_trait_fields() };
+        std::optional<unsigned> before_traits {};
+        std::optional<unsigned> after_traits {};
+        if (!trainer_field && sel_pkmn->generation() >= 3 &&
+            std::find(traits.begin(), traits.end(), field) != traits.end()) {
+            std::array<int, 4> before_values {};
+            std::array<int, 4> after_values {};
+            for (usize i = 0; i < traits.size(); ++i) {
+                before_values[i] = field_values.value(traits[i]).toInt();
+                after_values[i] = field_value(traits[i]).toInt();
+            }
+            before_traits = pack_pid_traits(before_values);
+            after_traits = pack_pid_traits(after_values);
+        }
+
+        if (before_traits && after_traits) {
+            step.type = undo_step::Pid_Traits;
+            step.before = static_cast<int>(shown_pid);
+            step.after = static_cast<int>(sel_pkmn->personality_value());
+            step.text = *before_traits | *after_traits << 16;
+            journal.record(step);
+            log_edit({ recovery_record::Pid_Traits, 0, static_cast<u16>(*after_traits),
+                       step.target, step.after });
+        } else if (qobject_cast<QLineEdit *>(field) != nullptr) {
+            step.type = undo_step::Text_Field;
+            journal.record(step, before.toString(), after.toString());
+            log_edit({ recovery_record::Text_Field, 0, field_id(field), step.target, 0,
+                       after.toString() });
+        } else {
+            step.before = before.toInt();
+            step.after = after.toInt();
+            journal.record(step);
+            log_edit({ recovery_record::Field, 0, field_id(field), step.target, step.after });
+        }
+    }
+
+    snapshot_field_values();
+    update_undo_actions();
+}
+
+void MainWindow::record_item_step(undo_step::kind type, item_category category, int row,
+                                  const QString &before_name, int before_count,
+                                  const QString &after_name, int after_count)
+{
+    undo_step step {};
+    step.type = type;
+    step.category = static_cast<u8>(category);
+    step.target = row;
+    step.before = before_count;
+    step.after = after_count;
+    journal.record(step, before_name, after_name);
+    log_edit({ item_op(type), step.category, 0, row, after_count, after_name });
+    update_undo_actions();
+}
+
+void MainWindow::undo_or_redo(bool redo)
+{
+    PKEDIT_TRACE_SCOPE("MainWindow::undo_or_redo");
+    if (!save_loaded || io_in_progress)
+        return;
+
+    // While typing in a field, its own undo goes first, as Ctrl+Z does there.
+    if (auto *line_edit = qobject_cast<QLineEdit *>(focusWidget());
+        line_edit != nullptr && !line_edit->isReadOnly() &&
+        (redo ? line_edit->isRedoAvailable() : line_edit->isUndoAvailable())) {
+        if (redo)
+            line_edit->redo();
+        else
+            line_edit->undo();
+        return;
+    }
+
+    // A field still being debounced holds the most recent edit.
+    edits->flush();
+    const std::vector<const undo_step *> steps { redo ? journal.redo() : journal.undo() };
+    if (steps.empty())
+        return;
+
+    try {
+        // A group is applied in the order it was recorded either way, as
+        // setting a level also sets the experience that follows it.
+        for (const undo_step *step : steps)
+            apply_undo_step(*step, redo);
+    } catch (const std::exception &e) {
+        // The save no longer matches the journal.
+        journal.clear();
+        show_popup_error(e.what());
+    }
+    update_undo_actions();
+}
+
+void MainWindow::apply_undo_step(const undo_step &step, bool redo)
+{
+    replaying_undo = true;
+    const auto done = qScopeGuard([this] {
+        replaying_undo = false;
+        snapshot_field_values();
+    });
+
+    auto *field = static_cast<QWidget *>(step.field);
+    const int value = redo ? step.after : step.before;
+    const auto category = static_cast<item_category>(step.category);
+    switch (step.type) {
+        case undo_step::Field:
+            apply_field_value(field, step.target, value);
+            log_edit({ recovery_record::Field, 0, field_id(field), step.target, value });
+            break;
+        case undo_step::Pid_Traits:
+            if (!apply_pid_traits(step.target, static_cast<u32>(value),
+                                  redo ? step.text >> 16 : step.text & 0xFFFF))
+                statusBar()->showMessage(
+                    QString("Restored the traits of PID %1; libpkedit chose PID %2")
+                        .arg(QString::number(static_cast<u32>(value), 16).toUpper(),
+                             QString::number(sel_pkmn->personality_value(), 16).toUpper()),
+                    5000);
+            break;
+        case undo_step::Text_Field: {
+            const QString &text { redo ? journal.text_after(step) : journal.text_before(step) };
+            apply_field_value(field, step.target, text);
+            log_edit({ recovery_record::Text_Field, 0, field_id(field), step.target, 0, text });
+            break;
+        }
+        case undo_step::Item_Edit:
+        case undo_step::Item_Insert:
+        case undo_step::Item_Remove: {
+            // Undoing an insert removes the row and vice versa.
+            undo_step::kind type = step.type;
+            if (!redo && type != undo_step::Item_Edit)
+                type = type == undo_step::Item_Insert ? undo_step::Item_Remove
+                                                      : undo_step::Item_Insert;
+            const QString &name { redo ? journal.text_after(step) : journal.text_before(step) };
+            apply_item_step(type, category, step.target, name, value);
+            log_edit({ item_op(type), step.category, 0, step.target, value, name });
+            break;
+        }
+    }
+}
+
+void MainWindow::select_party_pkmn(int target)
+{
+    pokemon *pkmn = party_model->pokemon_at(target);
+    if (pkmn == nullptr)
+        throw std::runtime_error("Unable to apply edit: Pokemon is no longer in the party");
+    if (pkmn != sel_pkmn || sel_pkmn_table_view != ui->partyTableView) {
+        sel_pkmn_table_view = ui->partyTableView;
+        sel_pkmn_table_row = target;
+        set_pkmn_in_editor(pkmn);
+    }
+}
+
+void MainWindow::apply_field_value(QWidget *field, int target, const QVariant &value)
+{
+    if (target != undo_journal::TRAINER)
+        select_party_pkmn(target);
+
+    set_field_value(field, value);
+    // Debounced fields are committed right away.
+    edits->flush();
+}
+
+bool MainWindow::apply_pid_traits(int target, u32 pid, unsigned traits)
+{
+    select_party_pkmn(target);
+    if (sel_pkmn->personality_value() == pid)
+        return true;
+
+    // libpkedit has no PID setter, so the traits are set one by one. Each
+    // re-rolls the PID, so the result can differ from the journaled one.
+    const std::array<QWidget *, 4> fields { pid_trait_fields() };
+    const std::array<int, 4> values { unpack_pid_traits(traits) };
+    for (usize i = 0; i < fields.size(); ++i)
+        if (field_value(fields[i]).toInt() != values[i])
+            set_field_value(fields[i], values[i]);
+    edits->flush();
+
+    log_edit({ recovery_record::Pid_Traits, 0, static_cast<u16>(traits), target,
+               static_cast<int>(pid) });
+    return sel_pkmn->personality_value() == pid;
+}
+
+void MainWindow::apply_item_step(undo_step::kind type, item_category category, int row,
+                                 const QString &name, int count)
+{
+    item_table_model *model = item_model_for(category);
+    if (type == undo_step::Item_Edit)
+        model->edit_item(row, name, count);
+    else if (type == undo_step::Item_Insert)
+        model->insert_item(row, name, count);
+    else
+        model->del_item(row);
+
+    if (model == sel_item_model) {
+        sel_item_table_view->clearSelection();
+        ui->editItemPushButton->setEnabled(false);
+        ui->deleteItemPushButton->setEnabled(false);
+    }
+}
+
+u16 MainWindow::field_id(const QObject *field) const
+{
+    for (usize i = 0; i < trainer_fields.size(); ++i)
+        if (trainer_fields[i] == field)
+            return static_cast<u16>(i);
+    for (usize i = 0; i < pkmn_fields.size(); ++i)
+        if (pkmn_fields[i] == field)
+            return static_cast<u16>(trainer_fields.size() + i);
+    throw std::runtime_error("untracked editor field");
+}
+
+QWidget *MainWindow::field_from_id(u16 id) const
+{
+    if (id < trainer_fields.size())
+        return trainer_fields[id];
+    if (id - trainer_fields.size() < pkmn_fields.size())
+        return pkmn_fields[id - trainer_fields.size()];
+    return nullptr;
+}
+
+void MainWindow::log_edit(const recovery_record &record) noexcept
+{
+    // Every edit of the save passes through here, replayed ones included.
+    save_modified = true;
+    if (!replaying_recovery)
+        recovery->append(record);
+}
+
+void MainWindow::start_recovery_journal(const std::string &path, const QByteArray &image)
+{
+    if (image.isEmpty())
+        return;
+
+    const std::vector<recovery_record> records { recovery_journal::read(path, image) };
+    const bool replay =
+        !records.empty() &&
+        QMessageBox::question(this, "Recover Unsaved Edits",
+                              QString("%1 edit(s) made to this save in an earlier session were "
+                                      "never saved. Replay them?")
+                                  .arg(records.size())) == QMessageBox::Yes;
+
+    if (!recovery->open(path, image, replay))
+        statusBar()->showMessage("Unable to create " + recovery_journal::path_for(path) +
+                                     "; unsaved edits will not be recoverable",
+                                 5000);
+    if (replay)
+        replay_recovery_records(records);
+}
+
+void MainWindow::replay_recovery_records(const std::vector<recovery_record> &records)
+{
+    PKEDIT_TRACE_SCOPE("MainWindow::replay_recovery_records");
+    replaying_recovery = true;
+    replaying_undo = true;
+    const auto done = qScopeGuard([this] {
+        replaying_recovery = false;
+        replaying_undo = false;
+        snapshot_field_values();
+    });
+
+    usize applied = 0;
+    usize pid_mismatches = 0;
+    try {
+        for (const recovery_record &record : records) {
+            const auto category = static_cast<item_category>(record.category);
+            switch (record.type) {
+                case recovery_record::Field:
+                case recovery_record::Text_Field: {
+                    QWidget *field = field_from_id(record.field);
+                    if (field == nullptr)
+                        throw std::runtime_error("Journal refers to an unknown field");
+                    if (record.type == recovery_record::Field)
+                        apply_field_value(field, record.target, record.value);
+                    else
+                        apply_field_value(field, record.target, record.text);
+                    break;
+                }
+                case recovery_record::Item_Edit:
+                    apply_item_step(undo_step::Item_Edit, category, record.target, record.text,
+                                    record.value);
+                    break;
+                case recovery_record::Item_Insert:
+                    apply_item_step(undo_step::Item_Insert, category, record.target,
+                                    record.text, record.value);
+                    break;
+                case recovery_record::Item_Remove:
+                    apply_item_step(undo_step::Item_Remove, category, record.target, {}, 0);
+                    break;
+                case recovery_record::Party_Remove:
+                    remove_party_pkmn(record.target);
+                    break;
+                case recovery_record::Bulk_Edit:
+                    apply_party_bulk_edit(static_cast<bulk_edit_op>(record.category),
+                                          static_cast<u32>(record.target), record.value);
+                    break;
+                case recovery_record::Pid_Traits:
+                    if (!apply_pid_traits(record.target, static_cast<u32>(record.value),
+                                          record.field))
+                        ++pid_mismatches;
+                    break;
+            }
+            ++applied;
+        }
+        QString message { QString("Recovered %1 unsaved edit(s)").arg(applied) };
+        if (pid_mismatches != 0)
+            message += QString("; libpkedit chose a different PID in %1 of them")
+                           .arg(pid_mismatches);
+        statusBar()->showMessage(message, 5000);
+    } catch (const std::exception &e) {
+        show_popup_error((QString("Recovered %1 of %2 edit(s): ")
+                              .arg(applied)
+                              .arg(records.size()) +
+                          e.what())
+                             .toStdString()
+                             .c_str());
+    }
+}
+
+void MainWindow::update_undo_actions()
+{
+    ui->actionUndo->setEnabled(save_loaded && !io_in_progress && journal.can_undo());
+    ui->actionRedo->setEnabled(save_loaded && !io_in_progress && journal.can_redo());
+}
+
+item_table_model *MainWindow::item_model_for(item_category category) const
+{
+    for (item_table_model *model : item_models)
+        if (model->item_type() == category)
+            return model;
+    throw std::runtime_error("invalid item category");
+}
+
+void MainWindow::open_file()
+{
+    if (io_in_progress)
+        return;
+
+    const QString filename { QFileDialog::getOpenFileName(nullptr, "Open File", "",
+                                                          QFILEDIALOG_FILTER) };
+    if (!filename.isEmpty())
+        open_file_path(filename);
+}
+
+void MainWindow::open_file_path(const QString &filename)
+{
+    if (io_in_progress)
+        return;
+
+    // Two tabs on one file would write over each other's recovery journal.
+    if (const int tab = tab_of_file(filename); tab >= 0) {
+        save_tabs->setCurrentIndex(tab);
+        return;
+    }
+
+    set_io_in_progress(true, "Loading " + filename + "...");
+
+    auto *watcher = new QFutureWatcher<io_result>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, filename] {
+        const io_result result { watcher->result() };
+        watcher->deleteLater();
+        set_io_in_progress(false, result.error.empty() ? "Loaded " + filename
+                                                        : "Failed to load " + filename);
+
+        if (!result.error.empty()) {
+            show_popup_error(result.error.c_str());
+            return;
+        }
+
+        set_loaded_save(result.save, filename);
+        ui->pcBoxTableView->setEnabled(pc_box_model->set_image(result.image));
+        if (result.image != nullptr) {
+            writer.track(filename.toStdString(), result.image);
+            start_recovery_journal(filename.toStdString(), result.image->bytes());
+        }
+        // Again, now that the boxes can be read from the tracked image.
+        start_legality_scan();
+    });
+
+    QFuture<io_result> future { QtConcurrent::run(
+        [ready = pkedit_ready, file_name = filename.toStdString()] {
+            io_result result {};
+            try {
+                ready.get();
+            } catch (const std::exception &e) {
+                result.error = std::string { "Error initializing libpkedit: " } + e.what();
+                return result;
+            }
+
+            // Just the load itself: not the file dialog nor the wait for libpkedit.
+            PKEDIT_TRACE_SCOPE("load_save");
+            try {
+                PKEDIT_TRACE_SCOPE("read_pkmn_save_file");
+                result.save = read_pkmn_save_file(file_name.c_str());
+            } catch (const std::exception &e) {
+                result.error = e.what();
+                return result;
+            }
+
+            // libpkedit only reads by path and keeps no bytes, so the file is
+            // read a second time here. The recovery journal hashes it for
+            // every generation, and Gen 3 boxes are decoded from it. The
+            // bytes were just read, so this is normally served from the page
+            // cache.
+            try {
+                result.image = save_writer::read_image(file_name);
+            } catch (const std::exception &) {
+                // Without the on-disk image the PC boxes can't be shown and
+                // edits aren't journaled; the save itself still works.
+            }
+            return result;
+        }) };
+    pending_io = QFuture<void>(future);
+    watcher->setFuture(future);
+}
+
+void MainWindow::compare_with_file()
+{
+    // A save in progress may be rewriting the file being compared.
+    if (io_in_progress)
+        return;
+
+    try {
+        if (!save_loaded)
+            throw std::runtime_error("Unable to compare: no save loaded");
+
+        // The shown save is compared as it is on disk, without unsaved edits.
+        const QString base { save_tabs->tabData(shown_save).toString() };
+        const QString other { QFileDialog::getOpenFileName(this, "Compare With", "",
+                                                           QFILEDIALOG_FILTER) };
+        if (other.isEmpty())
+            return;
+
+        struct diff_result {
+            save_diff diff {};
+            std::string error {};
+        };
+
+        statusBar()->showMessage("Comparing with " + other + "...");
+        auto *watcher = new QFutureWatcher<diff_result>(this);
+        connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, base, other] {
+            const diff_result result { watcher->result() };
+            watcher->deleteLater();
+            statusBar()->clearMessage();
+            if (!result.error.empty()) {
+                show_popup_error(result.error.c_str());
+                return;
+            }
+
+            auto *dialog = new diff_dialog(base, other, result.diff, this);
+            dialog->setAttribute(Qt::WA_DeleteOnClose);
+            dialog->show();
+        });
+
+        watcher->setFuture(
+            QtConcurrent::run([a_name = base.toStdString(), b_name = other.toStdString()] {
+                diff_result result {};
+                pkmn_save a {};
+                pkmn_save b {};
+                try {
+                    const std::shared_ptr<const mapped_file> image_a { mapped_file::open(a_name) };
+                    const std::shared_ptr<const mapped_file> image_b { mapped_file::open(b_name) };
+                    a = read_pkmn_save_file(a_name.c_str());
+                    b = read_pkmn_save_file(b_name.c_str());
+                    result.diff = diff_saves(a, image_a, b, image_b);
+                } catch (const std::exception &e) {
+                    result.error = e.what();
+                }
+                delete a.trainer;
+                delete b.trainer;
+                return result;
+            }));
+    } catch (const std::exception &e) {
+        show_popup_error(e.what());
+    }
+}
+
+void MainWindow::start_legality_scan()
+{
+    stop_legality_scan();
+    // A load or save worker holds the save being copied out below.
+    if (!save_loaded || io_in_progress)
+        return;
+
+    PKEDIT_TRACE_SCOPE("MainWindow::start_legality_scan");
+    // The party is copied out here, where the save is edited. The workers
+    // decode the boxes from the image as last read or written, and share
+    // ownership of it, so a later save doesn't replace it under them.
+    auto party = std::make_shared<std::vector<legality_input>>();
+    try {
+        const auto &team = save.trainer->pkmn_team();
+        for (usize i = 0; i < team.size(); ++i)
+            party->push_back(legality_input_of(team[i].get(), static_cast<u16>(i)));
+    } catch (const std::exception &e) {
+        show_popup_error(e.what());
+        return;
+    }
+
+    // Task -1 checks the party; the others each check one PC box.
+    auto boxes = std::make_shared<gen3_pc_boxes>();
+    QList<int> tasks { -1 };
+    if (boxes->open(writer.tracked_map()))
+        for (int box = 0; box < gen3_pc_boxes::BOX_COUNT; ++box)
+            tasks.append(box);
+
+    const std::function<std::vector<legality_issue>(int)> check = [party, boxes](int task) {
+        if (task >= 0)
+            return check_gen3_box(*boxes, task);
+        std::vector<legality_issue> out;
+        for (const legality_input &in : *party) {
+            const std::vector<legality_issue> found { check_party_pkmn(in) };
+            out.insert(out.end(), found.begin(), found.end());
+        }
+        return out;
+    };
+
+    legality->begin_scan();
+    auto *watcher = new QFutureWatcher<std::vector<legality_issue>>(this);
+    connect(watcher, &QFutureWatcherBase::resultReadyAt, this,
+            [this, watcher](int i) { legality->add_issues(watcher->resultAt(i)); });
+    connect(watcher, &QFutureWatcherBase::finished, this, [this] { legality->finish_scan(); });
+    legality_watcher = watcher;
+    watcher->setFuture(QtConcurrent::mapped(tasks, check));
+}
+
+void MainWindow::stop_legality_scan()
+{
+    if (legality_watcher == nullptr)
+        return;
+
+    // The workers only hold copies, so a stale scan may finish unobserved.
+    legality_watcher->disconnect(this);
+    legality_watcher->cancel();
+    legality_watcher->deleteLater();
+    legality_watcher = nullptr;
+    legality->clear();
+}
+
+void MainWindow::show_pkmn_in_slot(u16 slot)
+{
+    if (!save_loaded)
+        return;
+
+    if (slot < INDEX_PC_SLOT_BASE) {
+        pokemon *pkmn = party_model->pokemon_at(slot);
+        if (pkmn == nullptr)
+            return;
+        sel_pkmn_table_view = ui->partyTableView;
+        sel_pkmn_table_row = slot;
+        set_pkmn_in_editor(pkmn);
+        ui->tabWidget->setCurrentWidget(ui->tab_3);
+    } else if (ui->pcBoxTableView->isEnabled()) {
+        ui->tabWidget->setCurrentWidget(ui->tab_16);
+        ui->pcBoxTableView->selectRow(slot - INDEX_PC_SLOT_BASE);
+    }
+}
+
+void MainWindow::open_pid_search()
+{
+    if (pid_dialog == nullptr) {
+        QStringList natures;
+        // The first entry of the nature combo box is a placeholder.
+        for (int i = 1; i < ui->natureComboBox->count(); ++i)
+            natures.append(ui->natureComboBox->itemText(i));
+        pid_dialog = new pid_search_dialog(natures, this);
+    }
+    if (sel_pkmn != nullptr)
+        pid_dialog->set_trainer_ids(sel_pkmn->ot_public_id(), sel_pkmn->ot_secret_id());
+    else if (save_loaded)
+        pid_dialog->set_trainer_ids(save.trainer->public_id(), save.trainer->secret_id());
+    pid_dialog->show();
+    pid_dialog->raise();
+}
+
+void MainWindow::audit_rng_seeds()
+{
+    // A load or save worker holds the save and replaces the tracked image.
+    if (io_in_progress)
+        return;
+
+    try {
+        if (!save_loaded)
+            throw std::runtime_error("Unable to audit seeds: no save loaded");
+
+        // As in the legality scan, the party is copied here and the boxes
+        // are decoded from the image as last read or written, which the
+        // worker shares ownership of.
+        std::vector<indexed_pkmn> party;
+        const auto &team = save.trainer->pkmn_team();
+        for (usize i = 0; i < team.size(); ++i)
+            party.push_back(index_party_pkmn(team[i].get(), static_cast<u16>(i)));
+        const QString table_path {
+            QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + '/' +
+            seed_finder::CACHE_FILE_NAME
+        };
+
+        struct audit_result {
+            seed_audit audit {};
+            std::string error {};
+        };
+
+        statusBar()->showMessage("Searching for RNG seeds...");
+        auto *watcher = new QFutureWatcher<audit_result>(this);
+        connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher] {
+            const audit_result result { watcher->result() };
+            watcher->deleteLater();
+            statusBar()->clearMessage();
+            if (!result.error.empty()) {
+                show_popup_error(result.error.c_str());
+                return;
+            }
+
+            auto *dialog = new seed_audit_dialog(result.audit, this);
+            dialog->setAttribute(Qt::WA_DeleteOnClose);
+            connect(dialog, &seed_audit_dialog::pkmn_requested, this,
+                    [this](u16 slot) { show_pkmn_in_slot(slot); });
+            dialog->show();
+        });
+
+        watcher->setFuture(QtConcurrent::run(
+            [table_path, party = std::move(party), image = writer.tracked_map()] {
+                audit_result result {};
+                try {
+                    result.audit = audit_seeds(table_path, party, image);
+                } catch (const std::exception &e) {
+                    result.error = e.what();
+                }
+                return result;
+            }));
+    } catch (const std::exception &e) {
+        show_popup_error(e.what());
+    }
+}
+
+void MainWindow::set_loaded_save(const pkmn_save &loaded, const QString &file_name)
+{
+    // The save that was shown stays open in its own tab.
+    if (save_loaded)
+        park_shown_save();
+
+    workspace_save &opened = workspace.emplace_back();
+    opened.save = loaded;
+    opened.recovery = std::make_unique<recovery_journal>();
+    opened.models = create_save_models();
+    // Attached once; the models read the window's `save` while their tab is
+    // shown.
+    opened.models.party->set_save(&save);
+    for (item_table_model *model : opened.models.items)
+        model->set_save(&save);
+    {
+        const QSignalBlocker blocker { save_tabs };
+        const int tab = save_tabs->addTab(QFileInfo { file_name }.fileName());
+        save_tabs->setTabToolTip(tab, file_name);
+        save_tabs->setTabData(tab, file_name);
+    }
+    show_save(static_cast<int>(workspace.size()) - 1);
+}
+
+void MainWindow::park_shown_save()
+{
+    PKEDIT_TRACE_SCOPE("MainWindow::park_shown_save");
+    edits->flush();
+    stop_legality_scan();
+    stats_refresh_timer->stop();
+    shown_stats.reset();
+    set_pkmn_in_editor(nullptr);
+    block_pkmn_editor_signals(false);
+    sel_pkmn = nullptr;
+
+    workspace_save &parked = workspace[shown_save];
+    parked.save = std::exchange(save, {});
+    parked.writer = std::exchange(writer, {});
+    parked.journal = std::exchange(journal, undo_journal {});
+    parked.recovery = std::exchange(recovery, std::make_unique<recovery_journal>());
+    parked.modified = std::exchange(save_modified, false);
+    save_loaded = false;
+    shown_save = -1;
+}
+
+void MainWindow::show_save(int index)
+{
+    PKEDIT_TRACE_SCOPE("MainWindow::show_save");
+    workspace_save &shown = workspace[index];
+    save = std::exchange(shown.save, {});
+    writer = std::exchange(shown.writer, {});
+    journal = std::exchange(shown.journal, undo_journal {});
+    recovery = std::move(shown.recovery);
+    save_modified = shown.modified;
+    shown_save = index;
+    {
+        const QSignalBlocker blocker { save_tabs };
+        save_tabs->setCurrentIndex(index);
+    }
+
+    // The tab's own models and item name lists are swapped in, so nothing is
+    // decoded or listed again; only the trainer fields are refilled.
+    use_models(shown.models);
+    populate_ui_from_save();
+    ui->pcBoxTableView->setEnabled(pc_box_model->rowCount() > 0);
+    ui->editPkmnPartyPushButton->setEnabled(false);
+    ui->deletePkmnPartyPushButton->setEnabled(false);
+    ui->editItemPushButton->setEnabled(false);
+    ui->deleteItemPushButton->setEnabled(false);
+    update_undo_actions();
+    start_legality_scan();
+}
+
+save_models MainWindow::create_save_models()
+{
+    static constexpr std::array<item_category, 6> ITEM_TAB_CATEGORIES {
+        item_category::Pocket, item_category::Pokeball, item_category::Berry,
+        item_category::Tm,     item_category::Key_Item, item_category::Pc,
+    };
+
+    save_models models {};
+    models.party = new party_table_model(this);
+    models.pc_boxes = new pc_box_table_model(this);
+    for (usize i = 0; i < models.items.size(); ++i)
+        models.items[i] = new item_table_model(ITEM_TAB_CATEGORIES[i], this);
+    return models;
+}
+
+void MainWindow::use_models(const save_models &models)
+{
+    PKEDIT_TRACE_SCOPE("MainWindow::use_models");
+    party_model = models.party;
+    pc_box_model = models.pc_boxes;
+    item_models = models.items;
+    set_view_model(ui->partyTableView, party_model);
+    set_view_model(ui->pcBoxTableView, pc_box_model);
+    const std::array<QTableView *, 6> item_views { item_table_views() };
+    for (usize i = 0; i < item_views.size(); ++i)
+        set_view_model(item_views[i], item_models[i]);
+    sel_item_model = item_model_for(sel_item_category);
+
+    // The party view has a new selection model.
+    connect(ui->partyTableView->selectionModel(), &QItemSelectionModel::selectionChanged, this,
+            [this] {
+                // Several rows can be selected for bulk edits; editing and
+                // deleting take exactly one.
+                const bool single = selected_party_row() >= 0;
+                ui->editPkmnPartyPushButton->setEnabled(single);
+                ui->deletePkmnPartyPushButton->setEnabled(single && party_model->rowCount() > 1);
+            });
+}
+
+int MainWindow::selected_party_row() const
+{
+    const QModelIndexList rows { ui->partyTableView->selectionModel()->selectedRows() };
+    if (rows.size() != 1 || party_model->pokemon_at(rows.front().row()) == nullptr)
+        return -1;
+    return rows.front().row();
+}
+
+std::array<QTableView *, 6> MainWindow::item_table_views() const
+{
+    // Same order as the tabs in itemsTabWidget.
+    return { ui->itemsTableView, ui->ballsTableView,    ui->berriesTableView,
+             ui->tmsTableView,   ui->keyItemsTableView, ui->pcItemsTableView };
+}
+
+int MainWindow::tab_of_file(const QString &path, int except) const
+{
+    for (int tab = 0; tab < save_tabs->count(); ++tab)
+        if (tab != except && same_file(save_tabs->tabData(tab).toString(), path))
+            return tab;
+    return -1;
+}
+
+void MainWindow::switch_save(int index)
+{
+    if (index == shown_save || index < 0 || index >= static_cast<int>(workspace.size()))
+        return;
+    // Workers hold pointers into the shown save.
+    if (io_in_progress) {
+        const QSignalBlocker blocker { save_tabs };
+        save_tabs->setCurrentIndex(shown_save);
+        return;
+    }
+
+    park_shown_save();
+    show_save(index);
+}
+
+void MainWindow::close_save(int index)
+{
+    if (io_in_progress || index < 0 || index >= static_cast<int>(workspace.size()))
+        return;
+
+    if (index == shown_save)
+        edits->flush();
+    const bool modified = index == shown_save ? save_modified : workspace[index].modified;
+    if (modified &&
+        QMessageBox::question(this, "Close Save",
+                              QString("%1 has unsaved edits. Close it anyway?")
+                                  .arg(save_tabs->tabText(index)),
+                              QMessageBox::Yes | QMessageBox::No,
+                              QMessageBox::No) != QMessageBox::Yes)
+        return;
+
+    const save_models closed_models { workspace[index].models };
+    if (index == shown_save) {
+        edits->cancel();
+        stop_legality_scan();
+        reset_ui();
+        use_models(empty_models);
+        combo_models.clear_save_lists(save);
+        delete save.trainer;
+        save = {};
+        save_loaded = false;
+        writer.clear();
+        journal.clear();
+        recovery->close();
+        save_modified = false;
+        shown_save = -1;
+    } else {
+        combo_models.clear_save_lists(workspace[index].save);
+        delete workspace[index].save.trainer;
+        if (index < shown_save)
+            --shown_save;
+    }
+
+    workspace.erase(workspace.begin() + index);
+    delete closed_models.party;
+    delete closed_models.pc_boxes;
+    for (item_table_model *model : closed_models.items)
+        delete model;
+    {
+        const QSignalBlocker blocker { save_tabs };
+        save_tabs->removeTab(index);
+    }
+
+    if (shown_save < 0 && !workspace.empty()) {
+        show_save(std::min(index, static_cast<int>(workspace.size()) - 1));
+    } else if (workspace.empty()) {
+        ui->saveLoadedLabel->setText("Save file not loaded");
+        ui->saveLoadedLabel->setStyleSheet("font: 16pt \"Sans Serif\"; color: red;");
+        update_undo_actions();
+    }
+}
+
+void MainWindow::save_file_async(const QString &file_name)
+{
+    if (file_name.isEmpty() || io_in_progress)
+        return;
+
+    // Two tabs on one file would write over each other's recovery journal.
+    if (const int tab = tab_of_file(file_name, shown_save); tab >= 0) {
+        show_popup_error((file_name + " is open in another tab; close it before saving over it")
+                             .toStdString()
+                             .c_str());
+        return;
+    }
+
+    edits->flush();
+
+    set_io_in_progress(true, "Saving " + file_name + "...");
+
+    auto *watcher = new QFutureWatcher<io_result>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, file_name] {
+        const io_result result { watcher->result() };
+        watcher->deleteLater();
+        set_io_in_progress(false, result.error.empty()
+                                      ? "Saved " + file_name + describe_write(result.write_stats)
+                                      : "Failed to save " + file_name);
+
+        if (!result.error.empty()) {
+            show_popup_error(result.error.c_str());
+            return;
+        }
+
+        save_modified = false;
+        // After "Save As" the tab now stands for the new file.
+        save_tabs->setTabText(shown_save, QFileInfo { file_name }.fileName());
+        save_tabs->setTabToolTip(shown_save, file_name);
+        save_tabs->setTabData(shown_save, file_name);
+
+        // Everything journaled so far is now on disk.
+        recovery->remove();
+        if (!recovery->open(file_name.toStdString(), writer.tracked_image(), false))
+            statusBar()->showMessage("Unable to create " +
+                                         recovery_journal::path_for(file_name.toStdString()) +
+                                         "; unsaved edits will not be recoverable",
+                                     5000);
+    });
+
+    // The editors are locked until the worker finishes, so nothing else
+    // touches `save` in the meantime.
+    QFuture<io_result> future { QtConcurrent::run(
+        [s = &save, w = &writer, o = opt, name = file_name.toStdString()] {
+            io_result result {};
+            try {
+                result.write_stats = save_file(name, *s, o, *w);
+            } catch (const std::exception &e) {
+                result.error = e.what();
+            }
+            return result;
+        }) };
+    pending_io = QFuture<void>(future);
+    watcher->setFuture(future);
+}
+
+void MainWindow::populate_ui_from_save()
+{
+    PKEDIT_TRACE_SCOPE("MainWindow::populate_ui_from_save");
+    setUpdatesEnabled(false);
+    try {
+        block_all_signals(true);
+        save_loaded = true;
+        ui->saveLoadedLabel->setText(
+            (std::string { "Detected Save: Pokemon " } + save.game_name).data());
+        ui->saveLoadedLabel->setStyleSheet("font: 16pt \"Sans Serif\"; color: green;");
+        ui->nameLineEdit->setEnabled(true);
+        ui->genderComboBox->setEnabled(true);
+        ui->moneySpinBox->setEnabled(true);
+        ui->coinsSpinBox->setEnabled(true);
+        ui->partyTableView->setEnabled(true);
+        ui->addItemPushButton->setEnabled(true);
+        ui->nameLineEdit->setText(QString::fromStdWString(save.trainer->name()));
+        ui->genderComboBox->setCurrentIndex(save.trainer->is_female());
+
+        ui->nameLineEdit->setMaxLength(save.trainer->name_length());
+        ui->coinsSpinBox->setMaximum(save.trainer->max_coins());
+        ui->moneySpinBox->setMaximum(save.trainer->max_money());
+
+        ui->moneySpinBox->setValue(save.trainer->money());
+        ui->coinsSpinBox->setValue(save.trainer->coins());
+        ui->publicIdLineEdit->setText(
+            QString::fromStdString(std::to_string(save.trainer->public_id())));
+        ui->secretIdLineEdit->setText(
+            QString::fromStdString(std::to_string(save.trainer->secret_id())));
+        ui->publicIdLineEdit->setEnabled(true);
+        ui->secretIdLineEdit->setEnabled(true);
+
+        const trainer_time_played tm { save.trainer->time_played() };
+        ui->timePlayedLineEdit->setText(QString::fromStdString(std::to_string(tm.hours) + ":" +
+                                                               std::to_string(tm.minutes) + ":" +
+                                                               std::to_string(tm.seconds)));
+
+        ui->itemsTabWidget->setEnabled(true);
+        ui->itemsTableView->setEnabled(true);
+        ui->ballsTableView->setEnabled(true);
+        ui->berriesTableView->setEnabled(true);
+        ui->tmsTableView->setEnabled(true);
+        ui->keyItemsTableView->setEnabled(true);
+        ui->pcItemsTableView->setEnabled(true);
+
+        add_item_names_to_combo_box(ui->itemNameComboBox, sel_item_category);
+
+        ui->itemNameComboBox->setEnabled(true);
+        ui->quantitySpinBox->setEnabled(true);
+
+        block_all_signals(false);
+        snapshot_field_values();
+    } catch (std::exception &e) {
+        show_popup_error(e.what());
+        block_all_signals(false);
+    }
+    setUpdatesEnabled(true);
 }
 
 void MainWindow::modify_iv(QSpinBox *spin_box, pkstat stat)
@@ -1003,9 +2511,15 @@ void MainWindow::modify_iv(QSpinBox *spin_box, pkstat stat)
 
     const u8 iv = spin_box->value();
     try {
-        sel_pkmn->set_iv(stat, iv);
-        update_stats_on_ui(sel_pkmn);
+        {
+            PKEDIT_TRACE_SCOPE("pokemon::set_iv");
+            sel_pkmn->set_iv(stat, iv);
+        }
+        schedule_stats_refresh();
     } catch (std::exception &e) {
+        // The spin box no longer shows what the Pokemon has.
+        shown_stats.reset();
+        schedule_stats_refresh();
         show_popup_error(e.what());
     }
 }
@@ -1017,62 +2531,109 @@ void MainWindow::modify_ev(QSpinBox *spin_box, pkstat stat)
 
     const u8 ev = spin_box->value();
     try {
+        PKEDIT_TRACE_SCOPE("pokemon::set_ev");
         sel_pkmn->set_ev(stat, ev);
     } catch (std::exception &e) {
+        shown_stats.reset();
         show_popup_error(e.what());
     }
-    update_stats_on_ui(sel_pkmn);
+    schedule_stats_refresh();
+}
+
+static stat_view make_stat_view(const pokemon *pkmn)
+{
+    stat_view view {};
+    view.values.fill(-1);
+    auto &v = view.values;
+
+    v[stat_view::Hp] = pkmn->total_hp();
+    v[stat_view::Atk] = pkmn->attack();
+    v[stat_view::Def] = pkmn->defense();
+    v[stat_view::Spe] = pkmn->speed();
+    v[stat_view::Hp_Iv] = pkmn->hp_iv();
+    v[stat_view::Atk_Iv] = pkmn->attack_iv();
+    v[stat_view::Def_Iv] = pkmn->defense_iv();
+    v[stat_view::Spe_Iv] = pkmn->speed_iv();
+    v[stat_view::Hp_Ev] = pkmn->hp_ev();
+    v[stat_view::Atk_Ev] = pkmn->attack_ev();
+    v[stat_view::Def_Ev] = pkmn->defense_ev();
+    v[stat_view::Spe_Ev] = pkmn->speed_ev();
+
+    if (!pkmn->compat_has_spc_eviv()) {
+        v[stat_view::Spa] = pkmn->special_atk();
+        v[stat_view::Spd] = pkmn->special_def();
+        v[stat_view::Spa_Iv] = pkmn->special_atk_iv();
+        v[stat_view::Spd_Iv] = pkmn->special_def_iv();
+        v[stat_view::Spa_Ev] = pkmn->special_atk_ev();
+        v[stat_view::Spd_Ev] = pkmn->special_def_ev();
+    } else {
+        if (pkmn->compat_has_spc())
+            v[stat_view::Spc] = pkmn->special();
+        v[stat_view::Spc_Dv] = pkmn->special_dv();
+        v[stat_view::Spc_Ev] = pkmn->special_ev();
+    }
+
+    return view;
 }
 
 void MainWindow::update_stats_on_ui(const pokemon *pkmn) const
 {
+    PKEDIT_TRACE_SCOPE("MainWindow::update_stats_on_ui");
     if (pkmn == nullptr)
         return;
 
-    ui->hpSpinBox->setValue(pkmn->total_hp());
-    ui->atkSpinBox->setValue(pkmn->attack());
-    ui->defSpinBox->setValue(pkmn->defense());
-    ui->speSpinBox->setValue(pkmn->speed());
+    const stat_view next { make_stat_view(pkmn) };
+    if (shown_stats && shown_stats->values == next.values)
+        return;
 
-    if (!pkmn->compat_has_spc_eviv()) {
-        ui->spAtkSpinBox->setValue(pkmn->special_atk());
-        ui->spDefSpinBox->setValue(pkmn->special_def());
-        ui->spAtkIvSpinBox->setValue(pkmn->special_atk_iv());
-        ui->spDefIvSpinBox->setValue(pkmn->special_def_iv());
-        ui->spAtkEvSpinBox->setValue(pkmn->special_atk_ev());
-        ui->spDefEvSpinBox->setValue(pkmn->special_def_ev());
-    } else {
-        if (pkmn->compat_has_spc())
-            ui->spSpinBox->setValue(pkmn->special());
-        ui->spDvSpinBox->setValue(pkmn->special_dv());
-        ui->spcEvSpinBox->setValue(pkmn->special_ev());
+    const std::array<QSpinBox *, stat_view::Count> spin_boxes {
+        ui->hpSpinBox,      ui->atkSpinBox,     ui->defSpinBox,     ui->speSpinBox,
+        ui->spAtkSpinBox,   ui->spDefSpinBox,   ui->spSpinBox,      ui->hpIvSpinBox,
+        ui->atkIvSpinBox,   ui->defIvSpinBox,   ui->speIvSpinBox,   ui->spAtkIvSpinBox,
+        ui->spDefIvSpinBox, ui->spDvSpinBox,    ui->hpevSpinBox,    ui->atkEvSpinBox,
+        ui->defEvSpinBox,   ui->speEvSpinBox,   ui->spAtkEvSpinBox, ui->spDefEvSpinBox,
+        ui->spcEvSpinBox,
+    };
+
+    // The values come from the Pokemon itself, so writing them must not be
+    // mistaken for user edits. Repaint the page once, after every write.
+    QWidget *page = ui->pkmnEditorTabWidget->widget(PKMN_EDITOR_TAB_WIDGET_STATS);
+    page->setUpdatesEnabled(false);
+    for (usize i = 0; i < spin_boxes.size(); ++i) {
+        const int value = next.values[i];
+        if (value < 0 || (shown_stats && shown_stats->values[i] == value))
+            continue;
+        const QSignalBlocker blocker { spin_boxes[i] };
+        spin_boxes[i]->setValue(value);
     }
+    page->setUpdatesEnabled(true);
 
-    ui->hpIvSpinBox->setValue(pkmn->hp_iv());
-    ui->atkIvSpinBox->setValue(pkmn->attack_iv());
-    ui->defIvSpinBox->setValue(pkmn->defense_iv());
-    ui->speIvSpinBox->setValue(pkmn->speed_iv());
+    shown_stats = next;
+}
 
-    ui->hpevSpinBox->setValue(pkmn->hp_ev());
-    ui->atkEvSpinBox->setValue(pkmn->attack_ev());
-    ui->defEvSpinBox->setValue(pkmn->defense_ev());
-    ui->speEvSpinBox->setValue(pkmn->speed_ev());
+void MainWindow::schedule_stats_refresh()
+{
+    if (!stats_refresh_timer->isActive())
+        stats_refresh_timer->start();
 }
 
 void MainWindow::set_pkmn_in_editor(pokemon *pkmn)
 {
+    PKEDIT_TRACE_SCOPE("MainWindow::set_pkmn_in_editor");
+    // Pending edits target the Pokemon that is currently selected.
+    edits->flush();
     block_pkmn_editor_signals(true);
 
-    reset_combo_box(ui->speciesComboBox);
+    reset_shared_combo_box(ui->speciesComboBox);
     reset_combo_box(ui->abilityComboBox);
-    reset_combo_box(ui->heldItemComboBox);
+    reset_shared_combo_box(ui->heldItemComboBox);
     reset_combo_box(ui->originGameComboBox);
-    reset_combo_box(ui->locationComboBox);
+    reset_shared_combo_box(ui->locationComboBox);
     reset_combo_box(ui->pokeballComboBox);
-    reset_combo_box(ui->m1ComboBox);
-    reset_combo_box(ui->m2ComboBox);
-    reset_combo_box(ui->m3ComboBox);
-    reset_combo_box(ui->m4ComboBox);
+    reset_shared_combo_box(ui->m1ComboBox);
+    reset_shared_combo_box(ui->m2ComboBox);
+    reset_shared_combo_box(ui->m3ComboBox);
+    reset_shared_combo_box(ui->m4ComboBox);
 
     if (pkmn == nullptr)
         return;
@@ -1082,9 +2643,7 @@ void MainWindow::set_pkmn_in_editor(pokemon *pkmn)
     pkmn->allow_illegal_changes(opt.allow_illegal_modifications);
     const pkmn_allowed_set_fields *allow = pkmn->allowed_modifications();
 
-    auto all_species { pkmn->species_list() };
-    for (const auto &species : all_species)
-        ui->speciesComboBox->addItem(species->name());
+    set_shared_combo_box_model(ui->speciesComboBox, combo_models.species(pkmn));
     ui->speciesComboBox->setCurrentIndex(pkmn->species());
     ui->speciesComboBox->setEditable(allow->set_species | opt.allow_illegal_modifications);
     ui->speciesComboBox->setEnabled(allow->set_species | opt.allow_illegal_modifications);
@@ -1102,7 +2661,6 @@ void MainWindow::set_pkmn_in_editor(pokemon *pkmn)
     ui->friendshipSpinBox->setEnabled(true);
     update_pid_on_ui(pkmn);
 
-    u8 index;
     if (pkmn->compat_has_gender()) {
         set_pkmn_gender_combo_box(pkmn);
         ui->pkmnGenderComboBox->setEnabled(allow->set_gender | opt.allow_illegal_modifications);
@@ -1122,30 +2680,7 @@ void MainWindow::set_pkmn_in_editor(pokemon *pkmn)
     ui->tabWidget->setCurrentIndex(WINDOW_TAB_WIDGET_PKMN_EDITOR);
     ui->pkmnEditorTabWidget->setCurrentIndex(PKMN_EDITOR_TAB_WIDGET_DESCRIPTION);
 
-    switch (pkmn->status()) {
-        default:
-            throw std::runtime_error("invalid status condition");
-        case status_condition::HEALTHY:
-            index = PKMN_STATUS_COMBOBOX_HEALTHY;
-            break;
-        case status_condition::PAR:
-            index = PKMN_STATUS_COMBOBOX_PAR;
-            break;
-        case status_condition::PSN:
-            index = PKMN_STATUS_COMBOBOX_PSN;
-            break;
-        case status_condition::SLP:
-            index = PKMN_STATUS_COMBOBOX_SLP;
-            break;
-        case status_condition::FRZ:
-            index = PKMN_STATUS_COMBOBOX_FRZ;
-            break;
-        case status_condition::BRN:
-            index = PKMN_STATUS_COMBOBOX_BRN;
-            break;
-    }
-
-    ui->statusComboBox->setCurrentIndex(index);
+    ui->statusComboBox->setCurrentIndex(status_combo_index(pkmn->status()));
     ui->statusComboBox->setEnabled(true);
 
     if (pkmn->compat_has_ability()) {
@@ -1172,12 +2707,11 @@ void MainWindow::set_pkmn_in_editor(pokemon *pkmn)
     if (pkmn->compat_has_held_item()) {
         const item *held_item = pkmn->held_item();
         if (held_item != nullptr) {
-            std::span item_db { save.trainer->get_all_items() };
-            for (const auto &item : item_db)
-                ui->heldItemComboBox->addItem(item.name);
+            QStringListModel *items = combo_models.items(pkmn, save);
+            set_shared_combo_box_model(ui->heldItemComboBox, items);
             if (pkmn->has_item())
                 ui->heldItemComboBox->setCurrentIndex(
-                    save.trainer->item_idx_from_name(pkmn->held_item()->name()));
+                    combo_models.row_of(items, QString::fromUtf8(pkmn->held_item()->name())));
             else
                 ui->heldItemComboBox->setCurrentIndex(0);
             ui->heldItemComboBox->setEnabled(true);
@@ -1224,13 +2758,10 @@ void MainWindow::set_pkmn_in_editor(pokemon *pkmn)
     }
 
     if (pkmn->compat_has_location_met()) {
-        std::span met_locations { pkmn->met_locations_list() };
-        const u16 met = pkmn->met_location();
-        for (usize i = 0; i < met_locations.size(); ++i) {
-            ui->locationComboBox->addItem(met_locations[i].name);
-            if (met_locations[i].id == met)
-                ui->locationComboBox->setCurrentIndex(i);
-        }
+        set_shared_combo_box_model(ui->locationComboBox, combo_models.locations(pkmn));
+        const int met = combo_models.location_row(pkmn, pkmn->met_location());
+        if (met >= 0)
+            ui->locationComboBox->setCurrentIndex(met);
         ui->locationComboBox->setEnabled(allow->set_met_location | opt.allow_illegal_modifications);
         ui->locationComboBox->setEditable(allow->set_met_location |
                                           opt.allow_illegal_modifications);
@@ -1323,15 +2854,15 @@ void MainWindow::set_pkmn_in_editor(pokemon *pkmn)
     ui->defEvSpinBox->setEnabled(true);
     ui->speEvSpinBox->setEnabled(true);
 
+    stats_refresh_timer->stop();
+    shown_stats.reset();
     update_stats_on_ui(pkmn);
 
-    std::span move_list { pkmn->move_list() };
-    for (const auto &move : move_list) {
-        ui->m1ComboBox->addItem(move.name);
-        ui->m2ComboBox->addItem(move.name);
-        ui->m3ComboBox->addItem(move.name);
-        ui->m4ComboBox->addItem(move.name);
-    }
+    QStringListModel *moves = combo_models.moves(pkmn);
+    set_shared_combo_box_model(ui->m1ComboBox, moves);
+    set_shared_combo_box_model(ui->m2ComboBox, moves);
+    set_shared_combo_box_model(ui->m3ComboBox, moves);
+    set_shared_combo_box_model(ui->m4ComboBox, moves);
 
     const bool m_modifiable = allow->set_moveset | opt.allow_illegal_modifications;
     ui->m1ComboBox->setEnabled(m_modifiable);
@@ -1397,17 +2928,19 @@ void MainWindow::set_pkmn_in_editor(pokemon *pkmn)
 
     ui->pkmnSimulateTradePushButton->setEnabled(pkmn->has_trade_evolution());
 
+    // Toggling editability above recreates the line edits.
+    for (combo_name_search *search : name_searches)
+        search->attach();
+
     block_pkmn_editor_signals(false);
     sel_pkmn = pkmn;
+    snapshot_field_values();
 }
 
-void MainWindow::add_item_names_to_combo_box(QComboBox *combo_box, item_category category) const
+void MainWindow::add_item_names_to_combo_box(QComboBox *combo_box, item_category category)
 {
-    combo_box->clear();
-    std::vector item_names { save.trainer->get_item_names(category) };
-
-    for (const auto &item_name : item_names)
-        combo_box->addItem(item_name);
+    PKEDIT_TRACE_SCOPE("MainWindow::add_item_names_to_combo_box");
+    set_shared_combo_box_model(combo_box, combo_models.pocket_items(save, category));
 }
 
 void MainWindow::update_pid_on_ui(const pokemon *pkmn) const
@@ -1490,26 +3023,33 @@ void MainWindow::block_all_signals(bool block) const noexcept
     ui->secretIdLineEdit->blockSignals(block);
     ui->timePlayedLineEdit->blockSignals(block);
 
-    ui->partyTableWidget->blockSignals(block);
-    ui->itemsTableWidget->blockSignals(block);
-    ui->ballsTableWidget->blockSignals(block);
-    ui->keyItemsTableWidget->blockSignals(block);
-    ui->berriesTableWidget->blockSignals(block);
-    ui->tmsTableWidget->blockSignals(block);
-    ui->pcItemsTableWidget->blockSignals(block);
+    ui->partyTableView->blockSignals(block);
+    ui->itemsTableView->blockSignals(block);
+    ui->ballsTableView->blockSignals(block);
+    ui->keyItemsTableView->blockSignals(block);
+    ui->berriesTableView->blockSignals(block);
+    ui->tmsTableView->blockSignals(block);
+    ui->pcItemsTableView->blockSignals(block);
 }
 
 void MainWindow::reset_ui()
 {
     block_all_signals(true);
+    stats_refresh_timer->stop();
+    shown_stats.reset();
     set_pkmn_in_editor(nullptr);
-    reset_table_widget(ui->partyTableWidget);
-    reset_table_widget(ui->itemsTableWidget);
-    reset_table_widget(ui->ballsTableWidget);
-    reset_table_widget(ui->keyItemsTableWidget);
-    reset_table_widget(ui->berriesTableWidget);
-    reset_table_widget(ui->tmsTableWidget);
-    reset_table_widget(ui->pcItemsTableWidget);
+    party_model->set_save(nullptr);
+    reset_table_view(ui->partyTableView);
+    pc_box_model->clear();
+    reset_table_view(ui->pcBoxTableView);
+    for (item_table_model *model : item_models)
+        model->set_save(nullptr);
+    reset_table_view(ui->itemsTableView);
+    reset_table_view(ui->ballsTableView);
+    reset_table_view(ui->keyItemsTableView);
+    reset_table_view(ui->berriesTableView);
+    reset_table_view(ui->tmsTableView);
+    reset_table_view(ui->pcItemsTableView);
 
     reset_line_edit(ui->nameLineEdit);
     reset_combo_box(ui->genderComboBox);
@@ -1551,6 +3091,19 @@ void MainWindow::reset_combo_box(QComboBox *combo_box)
     combo_box->setEnabled(false);
 }
 
+void MainWindow::reset_shared_combo_box(QComboBox *combo_box)
+{
+    // The model is shared with other combo boxes, so it must not be cleared.
+    combo_box->setCurrentIndex(-1);
+    combo_box->setEnabled(false);
+}
+
+void MainWindow::set_shared_combo_box_model(QComboBox *combo_box, QStringListModel *model)
+{
+    if (combo_box->model() != model)
+        combo_box->setModel(model);
+}
+
 void MainWindow::reset_line_edit(QLineEdit *line_edit)
 {
     line_edit->clear();
@@ -1563,21 +3116,17 @@ void MainWindow::reset_spinbox(QSpinBox *spin_box)
     spin_box->setEnabled(false);
 }
 
-void MainWindow::reset_table_widget(QTableWidget *table_widget)
+void MainWindow::reset_table_view(QTableView *table_view)
 {
-    table_widget->clearContents();
-    table_widget->setRowCount(0);
-    table_widget->setEnabled(false);
+    table_view->clearSelection();
+    table_view->setEnabled(false);
 }
 
-void MainWindow::update_party_table_widget() const
+void MainWindow::update_party_table_row(int first_column, int last_column) const
 {
-    ui->partyTableWidget->blockSignals(true);
-    ui->partyTableWidget->clearContents();
-    ui->partyTableWidget->setRowCount(save.trainer->pkmn_team().size());
-    for (int i = 0; i < save.trainer->pkmn_team().size(); ++i)
-        add_pkmn_to_table_widget(ui->partyTableWidget, save.trainer->pkmn_team()[i].get(), i);
-    ui->partyTableWidget->blockSignals(false);
+    PKEDIT_TRACE_SCOPE("MainWindow::update_party_table_row");
+    if (sel_pkmn_table_view == ui->partyTableView)
+        party_model->refresh(sel_pkmn_table_row, first_column, last_column);
 }
 
 void MainWindow::set_pkmn_gender_combo_box(const pokemon *pkmn) const